@@ -9,15 +9,30 @@
 #include <stdio.h>
 #include <unistd.h>
 #include "Card.cpp"
+#include "HandEvaluator.cpp"
+#include "SuitIsomorphism.cpp"
+#include "BoardSummary.cpp"
+#include "Rng.cpp"
+#include "EquityEngine.cpp"
+#include "EquitySpeculator.cpp"
+#include "EquityEstimator.cpp"
+#include "PreflopTable.cpp"
+#include "FlopCache.cpp"
+#include "UserRange.cpp"
+#include "RiverSolver.cpp"
+#include "Player.cpp"
 #include <random>
+#include <algorithm>
+#include <chrono>
+#include <limits>
 using namespace std;
 
 
 // AI Class for playing Texas Hold 'em
 // Objects of the AI class have the following attributes:
-//  userRange: a 2D array of ints, referring to indices of the deck of Card objects in the GameManager class.
-//      This is how the AI tracks the hands that the user could possibly have throughout a hand
-//  handStrengths: an array of floats of strengths of hands corresponding to the hands in userRange
+//  range: the 1326 possible 2 card hands (see UserRange), with a weight for each saying whether the AI thinks the user
+//      could still have it, and each hand's latest strength.  This is how the AI tracks the hands that the user could
+//      possibly have throughout a hand
 // The idea of the AI is that it bases its decisions on how strong its own hand is compared to the hands
 //  that the AI thinks the user could have.  For example, at the beginning of the hand, the AI compares its hand
 //  to all 1326 2 card combinations that the user could have.  If the user bets, the AI might consider that the user
@@ -25,37 +40,76 @@ using namespace std;
 //  AI would only compare its own hand to about ~900 2 card combinations.  Based on how confident the AI is in its own hand
 //  compared to the user's possible hands, as well as the size of the current bet and the pot size, the AI will make
 //  decisions on whether to check, bet, call, raise, and fold.
-class AI {
+// The AI is a Player, so it can take either seat at the table (e.g. AI vs AI in a headless simulation).
+class AI : public Player {
 public:
-    int userRange[1326][2]; // there are 1326 possible 2 card hands
-    float handStrengths[1326];
-    int possibleUserHands;
+    UserRange range; // there are 1326 possible 2 card hands
+    float unlikelyHandWeight = 0.1; // how much less likely a hand becomes when it's too weak for the way the user bet
+    float minHandWeight = 0.001; // hands less likely than this are taken out of the range
+    float AIStrength; // the AI's own hand strength, scored along with the range (its exact hand rank at the river)
+    bool useExactEquity = true; // on the flop and turn, base decisions on exact equity against the range (see EquityEngine)
+    EquityEngine equityEngine;
+    bool useSampledEquity = true; // pre-flop, base decisions on sampled equity against the range (see EquityEstimator)
+    float sampledEquityError = 0.01; // the standard error to stop sampling at
+    double sampledEquityBudgetMs = 5.0; // the most time to spend sampling (only when decisions have a time budget)
+    EquityEstimator equityEstimator;
+    CardSet equityCards; // the AI's cards and the board cards that equityEngine's results were last computed for
+    double decisionBudgetMs = 20.0; // the most time to spend working out each decision (0 means no limit, see determineConfidence)
+                                    // headless simulations set it to 0, so a seeded game always plays out the same way
+    bool useRiverSolver = true; // on the river, play the strategy found by the river solver (see playRiverStrategy)
+    double riverSolverBudgetMs = 15.0; // the most time to spend solving the river (only when decisions have a time budget)
+    RiverSolver riverSolver;
+    bool useSpeculation = true; // while the user decides, work out equities the AI might need next (see EquitySpeculator)
+    EquitySpeculator speculator;
+    Rng rng; // the AI's own random number generator (see seed)
     // Default (and only) constructor for AI objects
     AI() {
         resetUserRange();
     }
-    int makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck);
+    int makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck, bool userActed);
+    void seed(Rng& source);
+    void resetHand() {
+        speculator.stop();
+        resetUserRange();
+    }
+    void startThinkingAhead(Card* AIHand, Card* boardCards, int betRound);
+    void stopThinkingAhead();
     float removeHandsFromRange(int currBet, int AILastBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck);
     float determineHandStrength(int currBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck);
-    float determineFlushOdds(Card* cards, int betRound);
-    float determineStraightOdds(Card* cards, int betRound);
-    float determineGoodPairOdds(Card* cards, int betRound);
-    float determineStraightFlushOdds(Card* cards, int betRound);
-    float determineFourOfAKindOdds(Card* cards, int betRound);
-    float determineFullHouseOdds(Card* cards, int betRound);
-    float determineThreeOfAKindOdds(Card* cards, int betRound);
-    float determineTwoPairOdds(Card* cards, int betRound);
+    float determineRiverStrength(Card* AIHand, Card* boardCards);
+    float determineRiverConfidence();
+    bool solveRiver(int currBet, int AILastBet, int potSize, int AIStack, int userStack, Card* boardCards, bool userActed, chrono::steady_clock::time_point deadline);
+    int playRiverStrategy(int currBet, int AILastBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck);
+    float determineConfidence(int currBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck, chrono::steady_clock::time_point deadline);
+    bool haveComboEquities(CardSet known);
+    bool determineComboEquities(Card* AIHand, Card* boardCards, int numBoardCards);
+    float determineSampledEquity(Card* AIHand, Card* boardCards, int numBoardCards, double timeBudgetMs);
+    float determinePreflopEquity(Card* AIHand);
+    void determineFlopStrengths(CardSet flop, float* strengths);
     int determineBetSize(int currBet, int AILastBet, int potSize, int AIStack, int userStack, float confidenceRatio);
     void resetUserRange();
 };
 
 
+// AI method for seeding every random number generator the AI owns, each with its own stream split off of source
+// (see Rng::forkStream), so everything the AI does from then on only depends on source's seed
+void AI::seed(Rng& source) {
+    rng = source.forkStream();
+    equityEstimator.rng = source.forkStream();
+}
+
+
 // AI method for making a bet decision.  The parameters are essentially everything relevant on the poker table.
 //  the current bet, the last bet the AI made, the pot size, the AI's stack, the user's stack, the AI's cards,
-//  the cards on the board, and what round of betting we're on
+//  the cards on the board, what round of betting we're on, and whether the user has already acted in it
 // Returns -1 if the AI decides to fold, 0 if the AI decides to check, and otherwise an integer that represents
 // the amount that the AI decides to bet (whether that is a call or a raise is shown with cout, and is handled in GameManager)
-int AI::makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck) {
+int AI::makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck, bool userActed) {
+    // the decision has to be worked out within decisionBudgetMs of now (if there's a budget)
+    chrono::steady_clock::time_point deadline = chrono::steady_clock::time_point::max();
+    if (decisionBudgetMs > 0) {
+        deadline = chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double, milli>(decisionBudgetMs));
+    }
     // if amount owed is more than AI's stack, make amount owed equal to AI's stack
     if ((currBet - AILastBet) > AIStack) {
         currBet = AILastBet + AIStack;
@@ -64,17 +118,24 @@ int AI::makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, in
     determineHandStrength(currBet, potSize, AIStack, userStack, AIHand, boardCards, betRound, deck);
     // remove hands from range, according to user's bet
     removeHandsFromRange(currBet, AILastBet, potSize, AIStack, userStack, AIHand, boardCards, betRound, deck);
-    cout << "Daniel is thinking..." << endl << endl;
-    usleep(3000000);
-    float confidenceRatio = determineHandStrength(currBet, potSize, AIStack, userStack, AIHand, boardCards, betRound, deck);
+    if (verbose) {
+        cout << "Daniel is thinking..." << endl << endl;
+    }
+    if ((betRound == 3) && useRiverSolver && (range.size() > 0) && solveRiver(currBet, AILastBet, potSize, AIStack, userStack, boardCards, userActed, deadline)) {
+        // on the river, the AI plays the strategy found by solving the rest of the hand rather than going by its confidence
+        return playRiverStrategy(currBet, AILastBet, potSize, AIStack, userStack, AIHand, boardCards, betRound, deck);
+    }
+    float confidenceRatio = determineConfidence(currBet, potSize, AIStack, userStack, AIHand, boardCards, betRound, deck, deadline);
     int amountOwed = currBet - AILastBet;
     int payout = potSize + amountOwed;    
     if ((currBet-AILastBet) == 0) { // if AI is first bet or user has checked
-        int rando = rand()%100;
+        int rando = rng.nextInt(100);
         // if AI less than 0.25 confident
         if (confidenceRatio <= 0.25) {
             // always check
-            cout << "Daniel checks." << endl;
+            if (verbose) {
+                cout << "Daniel checks." << endl;
+            }
             return 0;
         }
         // if AI 0.25-0.50 confident
@@ -86,7 +147,9 @@ int AI::makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, in
                 removeHandsFromRange(currBet+bet, currBet, potSize+bet+AILastBet, AIStack, userStack, AIHand, boardCards, betRound, deck);
                 return bet;
             } else { // 2/3 of the time check
-                cout << "Daniel checks." << endl;
+                if (verbose) {
+                    cout << "Daniel checks." << endl;
+                }
                 return 0;
             }
         }
@@ -98,7 +161,9 @@ int AI::makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, in
                 removeHandsFromRange(currBet+bet, currBet, potSize+bet, AIStack, userStack, AIHand, boardCards, betRound, deck);
                 return bet;
             } else { // 1/3 of the time check
-                cout << "Daniel checks." << endl;
+                if (verbose) {
+                    cout << "Daniel checks." << endl;
+                }
                 return 0;
             }
         }
@@ -117,20 +182,26 @@ int AI::makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, in
         float timesNeededToWin = (float)(amountOwed)/(float)(payout);
         // if AI's call is not statistically worth it
         if (confidenceRatio < timesNeededToWin) {
-            cout << "Daniel folds." << endl;
+            if (verbose) {
+                cout << "Daniel folds." << endl;
+            }
             return -1;
         }
         // if AI has reason to call
         else {
             // if this is just an all in decision
             if (amountOwed == AIStack) {
-                cout << "Daniel calls, going all in for $" << AIStack << "!" << endl;
+                if (verbose) {
+                    cout << "Daniel calls, going all in for $" << AIStack << "!" << endl;
+                }
                 return AIStack;
             } else if (userStack == 0) { // if the user just went all in
-                cout << "Daniel calls, putting in $" << currBet-AILastBet << "." << endl;
+                if (verbose) {
+                    cout << "Daniel calls, putting in $" << currBet-AILastBet << "." << endl;
+                }
                 return currBet-AILastBet;
             }
-            int rando = rand()%100;
+            int rando = rng.nextInt(100);
             // calculate where AI is within range of calling/raising
             // if timesNeededToWin = 0.25, and confidenceRatio = 0.5, this would equal 0.33
             // (0.5-0.25)/(1-0.25) = 0.25/0.75 = 1/3
@@ -138,13 +209,17 @@ int AI::makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, in
             // if on lower 0.25 of call/raise range
             if (raiseVsCall <= 0.25) {
                 // always call
-                cout << "Daniel calls, putting in $" << currBet-AILastBet << "." << endl;
+                if (verbose) {
+                    cout << "Daniel calls, putting in $" << currBet-AILastBet << "." << endl;
+                }
                 return currBet-AILastBet;
             }
             // if between 0.25 and 0.5 of call/raise range
             else if (raiseVsCall <= 0.50) {
                 if (rando <= 75) { // call 3/4 of the time
-                    cout << "Daniel calls, putting in $" << currBet-AILastBet << "." << endl;
+                    if (verbose) {
+                        cout << "Daniel calls, putting in $" << currBet-AILastBet << "." << endl;
+                    }
                     return currBet-AILastBet;
                 } else { // raise 1/4 of the time
                     int bet = determineBetSize(currBet, AILastBet, potSize, AIStack, userStack, confidenceRatio);
@@ -156,7 +231,9 @@ int AI::makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, in
             // if between 0.5 and 0.75 of call/raise range
             else if (raiseVsCall <= 0.75) {
                 if (rando <= 25) { // call 1/4 of the time
-                    cout << "Daniel calls, putting in $" << currBet-AILastBet << "." << endl;
+                    if (verbose) {
+                        cout << "Daniel calls, putting in $" << currBet-AILastBet << "." << endl;
+                    }
                     return currBet-AILastBet;
                 } else { // raise 3/4 of the time
                     int bet = determineBetSize(currBet, AILastBet, potSize, AIStack, userStack, confidenceRatio);
@@ -179,146 +256,25 @@ int AI::makeBetDecision(int currBet, int AILastBet, int potSize, int AIStack, in
 
 
 // Function for removing hands from the user's possible range
-// Depending on stage of hand, and the user's bet size compared to the pot, removes a variable number of hands
-// "Removed" hands are made to contain references to the 53rd card of the deck (index 52)
-// This "dead" card has a value of -1 and a suit of 'X'
+// First every hand holding a card the AI has just seen is taken out of the range's live bitset (see UserRange).  Then,
+// if the user bet, the weakest part of the range (more of it the bigger the bet is compared to the pot) has its
+// weights scaled down by unlikelyHandWeight, and hands whose weight drops below minHandWeight are taken out too
 float AI::removeHandsFromRange(int currBet, int AILastBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck) {
-    
-    /*
-    for (int i = 0; i < 1326; i++) {
-        cout << userRange[i][0] << ", " << userRange[i][1] << endl;
-    }
-     */
-    
-    // if beginning of hand, remove cards from userRange that contain AI's cards
-    if (betRound == 0) {
-        int numRemoved = 0;
-        int x = 0;
-        for (int i = 0; i < 52; i++) {
-            for (int j = i + 1; j < 52; j++) {
-                // check first of AI's cards for presence in userRange (both slots of userRange)
-                if ((deck[userRange[x][0]].suit == AIHand[0].suit) && (deck[userRange[x][0]].value == AIHand[0].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                } else if ((deck[userRange[x][1]].suit == AIHand[0].suit) && (deck[userRange[x][1]].value == AIHand[0].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                }
-                // then check second of AI's cards for presence in userRange (both slots of userRange)
-                else if ((deck[userRange[x][0]].suit == AIHand[1].suit) && (deck[userRange[x][0]].value == AIHand[1].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                } else if ((deck[userRange[x][1]].suit == AIHand[1].suit) && (deck[userRange[x][1]].value == AIHand[1].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                }
-                x += 1;
-            }
-        }
-        possibleUserHands -= numRemoved;
-    }
-    // on the flop, the AI can remove cards from the user's range that contain the three cards just dealt on the board
-    else if (betRound == 1) {
-        int numRemoved = 0;
-        int x = 0;
-        for (int i = 0; i < 52; i++) {
-            for (int j = i + 1; j < 52; j++) {
-                // check first board card
-                if ((deck[userRange[x][0]].suit == boardCards[0].suit) && (deck[userRange[x][0]].value == boardCards[0].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                } else if ((deck[userRange[x][1]].suit == boardCards[0].suit) && (deck[userRange[x][1]].value == boardCards[0].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                }
-                // check second board card
-                else if ((deck[userRange[x][0]].suit == boardCards[1].suit) && (deck[userRange[x][0]].value == boardCards[1].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                } else if ((deck[userRange[x][1]].suit == boardCards[1].suit) && (deck[userRange[x][1]].value == boardCards[1].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                }
-                // check third board card
-                else if ((deck[userRange[x][0]].suit == boardCards[2].suit) && (deck[userRange[x][0]].value == boardCards[2].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                } else if ((deck[userRange[x][1]].suit == boardCards[2].suit) && (deck[userRange[x][1]].value == boardCards[2].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                }
-                x += 1;
-            }
-        }
-        possibleUserHands -= numRemoved;
-    }
-    // on the turn, the AI can remove cards from the user's range that contain the fourth card just dealt on the board
-    else if (betRound == 2) {
-        int numRemoved = 0;
-        int x = 0;
-        for (int i = 0; i < 52; i++) {
-            for (int j = i + 1; j < 52; j++) {
-                // check fourth board card
-                if ((deck[userRange[x][0]].suit == boardCards[3].suit) && (deck[userRange[x][0]].value == boardCards[3].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                } else if ((deck[userRange[x][1]].suit == boardCards[3].suit) && (deck[userRange[x][1]].value == boardCards[3].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                }
-                x += 1;
-            }
-        }
-        possibleUserHands -= numRemoved;
-    }
-    // on the river, the AI can remove cards from the user's range that contain the fifth card just dealt on the board
-    else if (betRound == 3) {
-        int numRemoved = 0;
-        int x = 0;
-        for (int i = 0; i < 52; i++) {
-            for (int j = i + 1; j < 52; j++) {
-                // check fifth board card
-                if ((deck[userRange[x][0]].suit == boardCards[4].suit) && (deck[userRange[x][0]].value == boardCards[4].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                } else if ((deck[userRange[x][1]].suit == boardCards[4].suit) && (deck[userRange[x][1]].value == boardCards[4].value)) {
-                    numRemoved += 1;
-                    userRange[x][0] = 52;
-                    userRange[x][1] = 52;
-                }
-                x += 1;
-            }
-        }
-        possibleUserHands -= numRemoved;
-    }
+    // find the cards that were just revealed to the AI, which the user can no longer hold
+    CardSet newCards;
+    if (betRound == 0) { // if beginning of hand, remove hands from the range that contain AI's cards
+        newCards = CardSet::fromCards(AIHand, 2);
+    } else if (betRound == 1) { // on the flop, remove hands that contain the three cards just dealt on the board
+        newCards = CardSet::fromCards(boardCards, 3);
+    } else if (betRound == 2) { // on the turn, remove hands that contain the fourth card just dealt on the board
+        newCards.add(boardCards[3]);
+    } else if (betRound == 3) { // on the river, remove hands that contain the fifth card just dealt on the board
+        newCards.add(boardCards[4]);
+    }
+    range.removeCards(newCards);
     
     // if user bets into AI, and AI owes amount > 1 ( it would only be 1 if AI is little blind, in which case no user hands should be elim
-    if ((currBet - AILastBet) > 1) {
-        // go through userRange
-        float currStrengths[possibleUserHands];
-        int j = 0;
-        for (int i = 0; i < 1326; i++) {
-            if (deck[userRange[i][0]].value >= 0) {
-                currStrengths[j] = handStrengths[i];
-                j += 1;
-            }
-        }
-        // sort array (ends up being sorted highest -> lowest)
-        std::sort(currStrengths, currStrengths + possibleUserHands, std::greater<float>());
-        
+    if (((currBet - AILastBet) > 1) && (range.size() > 0)) {
         int amountOwed = currBet - AILastBet;
         float userBetPotRatio = (float)(amountOwed)/(float)(potSize - amountOwed);
         float ratioHandsRemoved = 0.0;
@@ -336,24 +292,12 @@ float AI::removeHandsFromRange(int currBet, int AILastBet, int potSize, int AISt
             ratioHandsRemoved = 0.90;
         }
         
-        int thresholdValueIndex = (int)((1.0-ratioHandsRemoved)*possibleUserHands);
-        float thresholdValue = currStrengths[thresholdValueIndex];
+        // the threshold is the strength of the hand where the strongest (1 - ratioHandsRemoved) of the range's weight ends
+        float thresholdValue = range.weightedPercentile(1.0-ratioHandsRemoved);
         
-        int numRemoved = 0;
-        // now iterate through userRange
-        for (int i = 0; i < 1326; i++) {
-            // only look at hands that haven't already been removed
-            if (deck[userRange[i][0]].value >= 0) {
-                // if this hand's strength is under the threshold we determined
-                if (handStrengths[i] < thresholdValue) {
-                    handStrengths[i] = -1.5;
-                    userRange[i][0] = 52;
-                    userRange[i][1] = 52;
-                    numRemoved += 1;
-                }
-            }
-        }
-        possibleUserHands -= numRemoved;
+        // now make every hand whose strength is under the threshold we determined less likely (rather than impossible,
+        // since the user could be bluffing), taking out any hand that's become too unlikely to matter
+        range.scaleBelow(thresholdValue, unlikelyHandWeight, minHandWeight);
     }
     
     
@@ -362,61 +306,302 @@ float AI::removeHandsFromRange(int currBet, int AILastBet, int potSize, int AISt
 
 
 // AI function for determining how strong it thinks its hand is.  It calculates the strength of its own hand, and then the strengths
-// of all the hands it thinks the user could have.  It determines the percent of user hands that its own hand beats, and returns that
-// ratio
+// of all the hands it thinks the user could have.  It determines the percent of user hands that its own hand beats (each hand counted
+// by how likely the user is to hold it), and returns that ratio
 float AI::determineHandStrength(int currBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck) {
-    Card* playableCards = new Card[7];
-    for (int i = 0; i < 2; i++) {
-        playableCards[i] = AIHand[i];
+    if (betRound == 3) { // at the river, the hands can be compared exactly
+        return determineRiverStrength(AIHand, boardCards);
+    }
+    // the strengths only depend on the board, so they're scored once per street; later calls on the same street (e.g. the
+    // next decision after the user raises) just count them again over whatever is left of the range
+    CardSet boardSet = CardSet::fromCards(boardCards, 5); // the cards that aren't dealt yet are dead, and left out
+    if (!range.scoredFor(boardSet, betRound)) {
+        // the board is summarized once, and each hand is scored from the board's summary plus its own two cards
+        // (pre-flop the board is empty, and only the flush, straight, and good pair odds count, see heuristicHandStrength)
+        BoardSummary board;
+        if (betRound > 0) {
+            board = summarizeBoard(boardCards, betRound);
+        }
+        // if pre-flop and the pre-flop table is loaded, hand strength is the hand's real equity against a random hand
+        bool usePreflopTable = (betRound == 0) && preflopTable.loaded;
+        // if flop and the flop cache is loaded, hand strengths are looked up instead of recomputed (see FlopCache)
+        const float* flopRow = NULL;
+        int perm[4];
+        if (usePreflopTable) {
+            AIStrength = preflopTable.equityVsRandom[preflopClass(AIHand[0].id(), AIHand[1].id())];
+        } else if ((betRound == 1) && flopCache.loaded) {
+            flopRow = flopCache.flopStrengths(CardSet::fromCards(boardCards, 3), perm);
+            AIStrength = flopRow[ComboTable::index(permuteCard(AIHand[0].id(), perm), permuteCard(AIHand[1].id(), perm))];
+        } else {
+            AIStrength = heuristicHandStrength(board.withHand(AIHand[0].id(), AIHand[1].id()), betRound);
+        }
+        int hands[1326];
+        int numHands = range.liveHands(hands);
+        for (int h = 0; h < numHands; h++) { // go through all of the hands that AI has decided user could still have
+            int i = hands[h];
+            // determine how strong this hand is, and store it
+            if (usePreflopTable) {
+                range.strengths[i] = preflopTable.equityVsRandom[preflopTable.comboClass[i]];
+            } else if (flopRow != NULL) {
+                range.strengths[i] = flopRow[ComboTable::index(permuteCard(range.firstCard[i], perm), permuteCard(range.secondCard[i], perm))];
+            } else {
+                range.strengths[i] = heuristicHandStrength(board.withHand(range.firstCard[i], range.secondCard[i]), betRound);
+            }
+        }
+        range.markScored(boardSet, betRound);
     }
-    for (int i = 2; i < 7; i++) {
-        playableCards[i] = boardCards[i-2];
+    // count the hands the AI has a better (or equal) hand than, out of the total hands user could have (by weight)
+    float confidenceRatio = 0.0;
+    float numTotalHands = 0.0;
+    float numWorseHands = range.countAtOrBelow(AIStrength, &numTotalHands);
+    if (numTotalHands > 0) {
+        confidenceRatio = numWorseHands/numTotalHands;
     }
-    float AIHandStrength = 0.0;
-    // if pre-flop, hand strength determined just from flush, straight, and good pair odds
-    if (betRound==0) {
-        AIHandStrength = determineFlushOdds(playableCards, betRound) + determineStraightOdds(playableCards, betRound) + determineGoodPairOdds(playableCards, betRound);
+    return confidenceRatio;
+}
+
+
+
+// AI function for scoring every two card hand on a flop with the hand strength heuristics, the same way
+// determineHandStrength does (used to build the flop cache)
+// Fills strengths with the score of every hand (indexed like the range), including hands that use one of the flop's cards
+void AI::determineFlopStrengths(CardSet flop, float* strengths) {
+    BoardSummary board;
+    uint64_t bits = flop.bits;
+    for (int i = 0; i < 3; i++) {
+        board.addCard(__builtin_ctzll(bits));
+        bits &= bits - 1;
     }
-    // if flop, turn, or river, hand strength determined with all hand possibilities
-    else {
-        AIHandStrength = determineFlushOdds(playableCards, betRound) + determineStraightOdds(playableCards, betRound) +
-            determineGoodPairOdds(playableCards, betRound) + determineStraightFlushOdds(playableCards, betRound) +
-            determineFourOfAKindOdds(playableCards, betRound) + determineFullHouseOdds(playableCards, betRound) +
-            determineThreeOfAKindOdds(playableCards, betRound) + determineTwoPairOdds(playableCards, betRound);
+    for (int i = 0; i < 1326; i++) {
+        strengths[i] = heuristicHandStrength(board.withHand(comboTable.cards[i][0], comboTable.cards[i][1]), 1);
     }
-    int numWorseHands = 0;
-    int numTotalHands = 0;
-    float confidenceRatio = 0.0;
-    float userHandStrength = 0.0;
-    int numChecked = 0;
-    for (int i = 0; i < 1326; i += 1) { // go through all possible two card hands
-        if (deck[userRange[i][0]].value != -1) { // all of the hands that AI has decided user could still have
-            numChecked += 1;
-            playableCards[0] = deck[userRange[i][0]];
-            playableCards[1] = deck[userRange[i][1]];
-            // determine how strong this hand is
-            // if pre-flop, hand strength determined just from flush, straight, and good pair odds
-            if (betRound==0) {
-                userHandStrength = determineFlushOdds(playableCards, betRound) + determineStraightOdds(playableCards, betRound) + determineGoodPairOdds(playableCards, betRound);
-            }
-            // if flop, turn, or river, hand strength determined with all hand possibilities
-            else {
-                userHandStrength = determineFlushOdds(playableCards, betRound) + determineStraightOdds(playableCards, betRound) +
-                determineGoodPairOdds(playableCards, betRound) + determineStraightFlushOdds(playableCards, betRound) +
-                determineFourOfAKindOdds(playableCards, betRound) + determineFullHouseOdds(playableCards, betRound) +
-                determineThreeOfAKindOdds(playableCards, betRound) + determineTwoPairOdds(playableCards, betRound);
-            }
-            handStrengths[i] = userHandStrength; // store this hand strength
-            if (userHandStrength <= AIHandStrength) { // if AI has a better (or equal) hand, count it (num hands AI beats)
-                numWorseHands += 1;
+}
+
+// Function for scoring a flop for FlopCache::build
+void scoreFlopForCache(CardSet flop, float* strengths) {
+    static AI scorer;
+    scorer.determineFlopStrengths(flop, strengths);
+}
+
+
+
+// AI function for determining exactly how strong its hand is at the river, when all of the cards are known.
+// Instead of the heuristic scores used on earlier streets, every hand the user could have is given its true seven card
+// rank (from the hand evaluator) once, and stored in the range's strengths.  Ranks fit in 24 bits, so a float holds them exactly.
+// Returns the share of the user's range (by weight) that the AI's hand beats or ties
+float AI::determineRiverStrength(Card* AIHand, Card* boardCards) {
+    CardSet board = CardSet::fromCards(boardCards, 5);
+    if (!range.scoredFor(board, 3)) { // only evaluated once, however many decisions there are on the river
+        AIStrength = (float)evaluateHand(board | CardSet::fromCards(AIHand, 2));
+        int hands[1326];
+        int numHands = range.liveHands(hands);
+        for (int h = 0; h < numHands; h++) { // all of the hands that AI has decided user could still have
+            range.strengths[hands[h]] = (float)evaluateHand(CardSet(board.bits | range.masks[hands[h]]));
+        }
+        range.markScored(board, 3);
+    }
+    return determineRiverConfidence();
+}
+
+
+// AI function for determining the share of the user's range (by weight) that the AI's hand beats or ties at the river
+// Uses the ranks stored by determineRiverStrength, so no hands are evaluated again: the weights of the hands ranked at
+// or below the AI's hand are read off the range's strength index (see UserRange)
+float AI::determineRiverConfidence() {
+    float totalWeight = 0.0;
+    float worseWeight = range.countAtOrBelow(AIStrength, &totalWeight);
+    if (totalWeight <= 0) {
+        return 0.0;
+    }
+    return worseWeight/totalWeight;
+}
+
+
+
+// AI function for determining how confident it is in its hand (from 0 to 1), against the hands the user could still have
+// The answer is refined for as long as there's time before the deadline, and the best one so far is returned:
+//  1. the heuristic hand strength (see determineHandStrength), which is always there to fall back on
+//  2. the AI's equity estimated by sampling (see determineSampledEquity), within sampledEquityBudgetMs
+//  3. on the flop and turn, the AI's exact equity (see determineComboEquities), if it's worked out before the deadline
+//     (if not, the enumeration is put aside, and the next decision on the same street carries on with it)
+// On the river, and pre-flop with the pre-flop table, the answer is exact straight away.  Without a deadline (a
+// deadline of max()) there's no need for a fallback, so the exact equity is always worked out on the flop and turn, and
+// nothing depends on the clock: sampling pre-flop only stops once it's within sampledEquityError, so the decision only
+// depends on the AI's random number generator (which is what makes a seeded simulation reproducible).
+float AI::determineConfidence(int currBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck, chrono::steady_clock::time_point deadline) {
+    if (betRound == 3) {
+        // at the river every hand's exact rank is already known, so only the range's new weights need accounting for
+        return determineRiverConfidence();
+    }
+    if ((betRound == 0) && preflopTable.loaded) {
+        // pre-flop, look up the AI's equity against each hand the user could have in the pre-flop table
+        return determinePreflopEquity(AIHand);
+    }
+    int numBoardCards = (betRound == 0) ? 0 : betRound + 2;
+    bool hasDeadline = (deadline != chrono::steady_clock::time_point::max());
+    bool useExact = (betRound > 0) && useExactEquity; // pre-flop there are far too many runouts to enumerate
+    CardSet known = CardSet::fromCards(AIHand, 2) | CardSet::fromCards(boardCards, numBoardCards);
+    if (useExact && haveComboEquities(known)) {
+        return equityEngine.rangeEquity(range.weights);
+    }
+    float confidenceRatio = determineHandStrength(currBet, potSize, AIStack, userStack, AIHand, boardCards, betRound, deck);
+    if (useSampledEquity && (!useExact || hasDeadline)) {
+        double budget = numeric_limits<double>::infinity();
+        if (hasDeadline) {
+            budget = min(sampledEquityBudgetMs, chrono::duration<double, milli>(deadline - chrono::steady_clock::now()).count());
+        }
+        if (budget > 0) {
+            confidenceRatio = determineSampledEquity(AIHand, boardCards, numBoardCards, budget);
+        }
+    }
+    if (useExact) {
+        equityEngine.deadline = deadline;
+        bool worked = determineComboEquities(AIHand, boardCards, numBoardCards);
+        equityEngine.deadline = chrono::steady_clock::time_point::max();
+        if (worked) {
+            confidenceRatio = equityEngine.rangeEquity(range.weights);
+        }
+    }
+    return confidenceRatio;
+}
+
+
+
+// AI function for solving the rest of the hand on the river (see RiverSolver), against the user's range
+// With a deadline, the solver runs for up to riverSolverBudgetMs (or until the deadline, if that's sooner).  Without
+// one (a deadline of max()) it runs its full riverSolver.maxIterations, so the strategy doesn't depend on the clock.
+// userActed is whether the user has already acted on the river: with nothing to call, that means the user checked, so
+// the AI checking behind ends the betting.
+// Returns whether there's a strategy to play (see playRiverStrategy); if not, the AI goes by its confidence instead
+bool AI::solveRiver(int currBet, int AILastBet, int potSize, int AIStack, int userStack, Card* boardCards, bool userActed, chrono::steady_clock::time_point deadline) {
+    chrono::steady_clock::time_point solverDeadline = deadline;
+    if (deadline != chrono::steady_clock::time_point::max()) {
+        solverDeadline = min(deadline, chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double, milli>(riverSolverBudgetMs)));
+    }
+    int amountOwed = currBet - AILastBet;
+    return riverSolver.solve(CardSet::fromCards(boardCards, 5), range.weights, potSize, amountOwed, userActed, AIStack, userStack, solverDeadline) > 0;
+}
+
+
+// AI function for making its bet decision on the river from the strategy found by solveRiver
+// The AI picks an action at random according to how often the solved strategy takes each one with its hand
+// Returns the bet, as for makeBetDecision
+int AI::playRiverStrategy(int currBet, int AILastBet, int potSize, int AIStack, int userStack, Card* AIHand, Card* boardCards, int betRound, Card* deck) {
+    int amountOwed = currBet - AILastBet;
+    float probabilities[4];
+    riverSolver.rootStrategy(ComboTable::index(AIHand[0].id(), AIHand[1].id()), probabilities);
+    const RiverNode& root = riverSolver.nodes[0];
+    float rando = rng.nextFloat();
+    int action = root.numActions - 1;
+    for (int a = 0; a < root.numActions - 1; a++) {
+        if (rando < probabilities[a]) {
+            action = a;
+            break;
+        }
+        rando -= probabilities[a];
+    }
+    int amount = root.actionAmounts[action];
+    if (amount == -1) {
+        if (verbose) {
+            cout << "Daniel folds." << endl;
+        }
+        return -1;
+    } else if (amount == 0) {
+        if (verbose) {
+            cout << "Daniel checks." << endl;
+        }
+        return 0;
+    } else if (amount <= amountOwed) {
+        if (verbose) {
+            if (amount == AIStack) {
+                cout << "Daniel calls, going all in for $" << AIStack << "!" << endl;
+            } else {
+                cout << "Daniel calls, putting in $" << amount << "." << endl;
             }
-            numTotalHands += 1; // count total hands user could have
+        }
+        return amount;
+    }
+    if (verbose) {
+        if (amount == AIStack) {
+            cout << "Daniel puts in $" << amount << ", going all in!" << endl;
         } else {
-            handStrengths[i] = -1.5;
+            cout << "Daniel raises to $" << AILastBet+amount << "." << endl;
         }
     }
-    confidenceRatio = (float)(numWorseHands)/(float)(numTotalHands);
-    return confidenceRatio;
+    // Remove some hands here, because if the user just calls then the AI needs to update
+    removeHandsFromRange(AILastBet+amount, currBet, potSize+amount, AIStack, userStack, AIHand, boardCards, betRound, deck);
+    return amount;
+}
+
+
+
+// AI function for checking whether equityEngine holds the AI's exact equities for the known cards (the AI's cards and
+// the board cards), taking them from the speculator if they were worked out while the user was deciding
+bool AI::haveComboEquities(CardSet known) {
+    if ((known.bits != equityCards.bits) && speculator.take(known, equityEngine.comboEquity)) {
+        equityCards = known;
+    }
+    return known.bits == equityCards.bits;
+}
+
+
+
+// AI function for working out its exact equity (its share of the pot if the rest of the board were dealt out now)
+// against each hand the user could have.  The equity against each possible hand only depends on the known cards,
+// so it's computed by the EquityEngine once per street, and later decisions on the same street (e.g. after the user
+// raises, and hands are removed from the range) just re-average it over the new range (see EquityEngine::rangeEquity).
+// numBoardCards is how many board cards have been dealt (0, 3, 4, or 5)
+// Returns whether equityEngine holds the equities (it won't if it ran out of time working them out)
+bool AI::determineComboEquities(Card* AIHand, Card* boardCards, int numBoardCards) {
+    CardSet known = CardSet::fromCards(AIHand, 2) | CardSet::fromCards(boardCards, numBoardCards);
+    if (haveComboEquities(known)) {
+        return true;
+    }
+    if (!equityEngine.computeComboEquities(AIHand, boardCards, numBoardCards)) {
+        return false;
+    }
+    equityCards = known;
+    return true;
+}
+
+
+
+// AI function for getting ahead on its work while the user decides on a bet (see EquitySpeculator)
+// Only the flop and turn are worth it: the AI doesn't use exact equities pre-flop or on the river
+void AI::startThinkingAhead(Card* AIHand, Card* boardCards, int betRound) {
+    if (!useSpeculation || !useExactEquity || (betRound < 1) || (betRound > 2)) {
+        return;
+    }
+    int numBoardCards = betRound + 2;
+    CardSet known = CardSet::fromCards(AIHand, 2) | CardSet::fromCards(boardCards, numBoardCards);
+    // results worked out last time the user decided (e.g. for the card that just came) are taken before starting over
+    speculator.start(AIHand, boardCards, numBoardCards, !haveComboEquities(known));
+}
+
+
+
+// AI function for stopping the work started by startThinkingAhead, once the user has bet
+void AI::stopThinkingAhead() {
+    speculator.stop();
+}
+
+
+
+// AI function for estimating its equity against the hands the user could still have, by sampling (see EquityEstimator)
+// Sampling stops once the estimate is within sampledEquityError, or after timeBudgetMs, so this takes a
+// bounded amount of time no matter how big the range is or how many runouts there are
+// Returns the AI's estimated equity against the user's range, from 0 to 1
+float AI::determineSampledEquity(Card* AIHand, Card* boardCards, int numBoardCards, double timeBudgetMs) {
+    EquityEstimate estimate = equityEstimator.estimate(AIHand, boardCards, numBoardCards, range.weights, sampledEquityError, timeBudgetMs);
+    return estimate.equity;
+}
+
+
+
+// AI function for determining its pre-flop equity against the hands the user could still have, from the pre-flop table
+// Returns the AI's equity against the user's range, from 0 to 1
+float AI::determinePreflopEquity(Card* AIHand) {
+    return preflopTable.rangeEquity(preflopClass(AIHand[0].id(), AIHand[1].id()), range.weights);
 }
 
 
@@ -425,7 +610,7 @@ float AI::determineHandStrength(int currBet, int potSize, int AIStack, int userS
 // is in its hand, the current bet, the pot size, etc.
 // Returns an int referring to the amount the AI wishes to bet
 int AI::determineBetSize(int currBet, int AILastBet, int potSize, int AIStack, int userStack, float confidenceRatio) {
-    int rando = rand()%100;
+    int rando = rng.nextInt(100);
     int bet;
     
     // if the AI is very confident
@@ -468,937 +653,21 @@ int AI::determineBetSize(int currBet, int AILastBet, int potSize, int AIStack, i
     // if AI's desired bet is more than it has, only allow bet of AIStack
     if (bet > AIStack) {
         bet = AIStack;
-        cout << "Daniel puts in $" << bet << ", going all in!" << endl;
-    } else {
-        cout << "Daniel raises to $" << currBet+bet << "." << endl;
-    }
-    return bet;
-}
-
-
-
-// Determines how likely it is for the input cards to achieve a flush
-// The parameter "cards" contains the two hole cards (whether that be the AI's cards or the two cards of a user's possible hand),
-// and the current board cards.  Based on the parameter betRound (referring to if it's pre-flop, on the turn, etc), the flush
-// likelihood is determined differently.
-// Returns an arbitrary float based on how close to a flush these cards are
-float AI::determineFlushOdds(Card* cards, int betRound) {
-    if (betRound == 0) { // pre-flop
-        if (cards[0].suit == cards[1].suit) {
-            return 0.80; // if the AI's two cards are suited pre-flop, return 1.0
-        } else {
-            return 0.0; // if they're not, return 0.0
-        }
-    } else if (betRound == 1) { // flop
-        int numHearts = 0, numDiamonds = 0, numSpades = 0, numClubs = 0;
-        for (int i = 0; i < 5; i++) { // count number of each suit there are
-            if (cards[i].suit == 'H') {
-                numHearts += 1;
-            } else if (cards[i].suit == 'D') {
-                numDiamonds += 1;
-            } else if (cards[i].suit == 'S') {
-                numSpades += 1;
-            } else {
-                numClubs += 1;
-            }
-        }
-        if ((numHearts == 5) || (numDiamonds == 5) || (numSpades == 5) || (numClubs == 5)) { // if already made flush
-            return 5.0;
-        } else if ((numHearts == 4) || (numDiamonds == 4) || (numSpades == 4) || (numClubs == 4)) { // if 4/5 suited cards
-            return 1.25;
-        } else if ((numHearts == 3) || (numDiamonds == 3) || (numSpades == 3) || (numClubs == 3)) { // if 3/5 suited cards
-            return 0.25;
-        } else { // if only 2/5 suited cards (this is the minimum at the flop, flush is impossible)
-            return 0.0;
-        }
-    } else if (betRound == 2) { // turn
-        int numHearts = 0, numDiamonds = 0, numSpades = 0, numClubs = 0;
-        for (int i = 0; i < 6; i++) { // count number of each suit there are
-            if (cards[i].suit == 'H') {
-                numHearts += 1;
-            } else if (cards[i].suit == 'D') {
-                numDiamonds += 1;
-            } else if (cards[i].suit == 'S') {
-                numSpades += 1;
-            } else {
-                numClubs += 1;
-            }
-        }
-        if ((numHearts >= 5) || (numDiamonds >= 5) || (numSpades >= 5) || (numClubs >= 5)) { // if already made flush
-            return 5.0;
-        } else if ((numHearts == 4) || (numDiamonds == 4) || (numSpades == 4) || (numClubs == 4)) { // if 4/5 suited cards
-            return 1.25;
-        } else { // if less than 4/5 suited cards (if so at the turn, flush is impossible)
-            return 0.0;
-        }
-    } else { // river
-        int numHearts = 0, numDiamonds = 0, numSpades = 0, numClubs = 0;
-        for (int i = 0; i < 7; i++) { // count number of each suit there are
-            if (cards[i].suit == 'H') {
-                numHearts += 1;
-            } else if (cards[i].suit == 'D') {
-                numDiamonds += 1;
-            } else if (cards[i].suit == 'S') {
-                numSpades += 1;
-            } else {
-                numClubs += 1;
-            }
-        }
-        if ((numHearts >= 5) || (numDiamonds >= 5) || (numSpades >= 5) || (numClubs >= 5)) { // if made flush
-            return 5.0;
-        } else { // no flush
-            return 0.0;
-        }
-    }
-    return 0.0;
-}
-
-
-// Determines how likely it is for the input cards to achieve a straight
-// The parameter "cards" contains the two hole cards (whether that be the AI's cards or the two cards of a user's possible hand),
-// and the current board cards.  Based on the parameter betRound (referring to if it's pre-flop, on the turn, etc), the straight
-// likelihood is determined differently.
-// Returns an arbitrary float based on how close to a straight these cards are
-float AI::determineStraightOdds(Card* cards, int betRound) {
-    if (betRound == 0) { // pre-flop
-        if (abs(cards[0].value - cards[1].value) == 0) { // if the two cards have same value
-            return 0.0;
-        } else if (abs(cards[0].value - cards[1].value) == 1) { // if two adjacent cards
-            return 1.0;
-        } else if (abs(cards[0].value - cards[1].value) < 5) { // if cards separated by 2-4
-            return 0.5;
-        } else if (abs(cards[0].value - cards[1].value) > 8 ) { // if cards separated by greater than 8 (i.e., maybe an ace in a possible straight hand))
-            int firstVal = cards[0].value;
-            int secondVal = cards[1].value;
-            if (firstVal == 14) { // update first value if it's an ace
-                firstVal = 1;
-            }
-            if (secondVal == 14) { // update second value if it's an ace
-                secondVal = 1;
-            }
-            if ((firstVal - secondVal) == 1) { // ace - two
-                return 1.0;
-            } else if ((firstVal - secondVal) < 5) { // ace - three, four, or five
-                return 0.5;
-            } else {
-                return 0.0;
-            }
-        } else { // if cards separated by 5-8 (definitely no straight possible)
-            return 0.0;
-        }
-    } else if (betRound == 1) { // flop
-        float bestVal = 0.0;
-        for (int i = 0; i < 5; i++) { // test each card as top card of straight
-            for (int j = 0; j < 5; j++) { // see if first card below exists
-                if (cards[j].value == cards[i].value - 1) {
-                    for (int k = 0; k < 5; k++) { // see if second card below exists
-                        if (cards[k].value == cards[i].value - 2) {
-                            if (bestVal < 0.4) {
-                                bestVal = 0.4;
-                            }
-                            for (int l = 0; l < 5; l++) { // see if third card below exists
-                                if (cards[l].value == cards[i].value - 3) {
-                                    if (bestVal < 0.6) {
-                                        bestVal = 0.6;
-                                    }
-                                    for (int m = 0; m < 5; m++) { // see if straight is already made
-                                        if (cards[m].value == cards[i].value - 4) {
-                                            if (bestVal < 4.0) {
-                                                bestVal = 4.0;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            
-        }
-        return bestVal;
-    } else if (betRound == 2) { // turn
-        float bestVal = 0.0;
-        for (int i = 0; i < 6; i++) { // test each card as top card of straight
-            for (int j = 0; j < 6; j++) { // see if first card below exists
-                if (cards[j].value == cards[i].value - 1) {
-                    for (int k = 0; k < 6; k++) { // see if second card below exists
-                        if (cards[k].value == cards[i].value - 2) {
-                            for (int l = 0; l < 6; l++) { // see if third card below exists
-                                if (cards[l].value == cards[i].value - 3) {
-                                    if (bestVal < 0.6) {
-                                        bestVal = 0.6;
-                                    }
-                                    for (int m = 0; m < 6; m++) { // see if straight is already made
-                                        if (cards[m].value == cards[i].value - 4) {
-                                            if (bestVal < 4.0) {
-                                                bestVal = 4.0;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            
-        }
-        return bestVal;
-    } else { // river
-        float bestVal = 0.0;
-        for (int i = 0; i < 7; i++) { // test each card as top card of straight
-            for (int j = 0; j < 7; j++) { // see if first card below exists
-                if (cards[j].value == cards[i].value - 1) {
-                    for (int k = 0; k < 7; k++) { // see if second card below exists
-                        if (cards[k].value == cards[i].value - 2) {
-                            for (int l = 0; l < 7; l++) { // see if third cards below exists
-                                if (cards[l].value == cards[i].value - 3) {
-                                    for (int m = 0; m < 7; m++) { // see if straight is already made
-                                        if (cards[m].value == cards[i].value - 4) {
-                                            if (bestVal < 4.0) {
-                                                bestVal = 4.0;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            
-        }
-        return bestVal;
-    }
-    return 0.0;
-}
-
-
-// Determines how likely it is for the input cards to achieve a good pair (the higher the pair the better)
-// The parameter "cards" contains the two hole cards (whether that be the AI's cards or the two cards of a user's possible hand),
-// and the current board cards.  Based on the parameter betRound (referring to if it's pre-flop, on the turn, etc), the high pair
-// likelihood is determined differently.
-// Returns an arbitrary float based on how close to a high pair these cards are
-float AI::determineGoodPairOdds(Card* cards, int betRound) {
-    if (betRound == 0) { // pre-flop
-        if (cards[0].value == cards[1].value) { // if the AI has a pocket pair
-            if (cards[0].value == 14) { // pad odds if pocket aces
-                return 5.0;
-            } else if (cards[0].value == 13) { // and if pocket kings
-                return 4.75;
-            } else if (cards[0].value == 12) { // and if pocket queens
-                return 4.5;
-            } else {
-                float val = (cards[0].value / 14.0) * 3.0;
-                return val;
-            }
-        } else {
-            float cardSum = cards[0].value + cards[1].value;
-            cardSum = (float)(cardSum/27*1.5); // highest sum, of not paired cards, would be 14 + 13 (ace king) so we normalize across that range.  I then multiply 1.5 as a custom factor to get the AI to play more hands with high cards
-            return cardSum;
-        }
-    } else if (betRound == 1) { // flop
-        bool hasPair = false;
-        int pairVal = -1;
-        int highVal = -1;
-        // find if pair exists, remember highest pair (and also remember highest val sans pair)
-        for (int i = 0; i < 5; i++) {
-            if (cards[i].value > highVal) {
-                highVal = cards[i].value;
-            }
-            for (int j = 0; j < 5; j++) {
-                if ((cards[i].value == cards[j]. value) && (i != j)) {
-                    hasPair = true;
-                    if (cards[i].value > pairVal) {
-                        pairVal = cards[i].value;
-                    }
-                }
-            }
-        }
-        if (hasPair) { // if a pair exists
-            if (pairVal == 14) { // if aces
-                return 2.5;
-            } else if (pairVal == 13) { // if kings
-                return 2.25;
-            } else if (pairVal == 12) { // if queens
-                return 2.0;
-            } else { // anything lower
-                float val = (float)((pairVal / 14.0)*1.5);
-                return val;
-            }
-        } else {
-            // if no pair, just return highVal, normalized across 1 according to all possible card values (2 - 14)
-            float val = (float)(highVal / 14.0);
-            return val;
-        }
-    } else if (betRound == 2) { // turn
-        bool hasPair = false;
-        int pairVal = -1;
-        int highVal = -1;
-        // find if pair exists, remember highest pair (and also remember highest val sans pair)
-        for (int i = 0; i < 6; i++) {
-            if (cards[i].value > highVal) {
-                highVal = cards[i].value;
-            }
-            for (int j = 0; j < 6; j++) {
-                if ((cards[i].value == cards[j]. value) && (i != j)) {
-                    hasPair = true;
-                    if (cards[i].value > pairVal) {
-                        pairVal = cards[i].value;
-                    }
-                }
-            }
-        }
-        if (hasPair) { // if a pair exists
-            if (pairVal == 14) { // if aces
-                return 2.5;
-            } else if (pairVal == 13) { // if kings
-                return 2.25;
-            } else if (pairVal == 12) { // if queens
-                return 2.0;
-            } else { // anything lower
-                float val = (float)((pairVal / 14.0)*1.5);
-                return val;
-            }
-        } else {
-            // if no pair, just return highVal, normalized across 1 according to all possible card values (2 - 14)
-            float val = (float)(highVal / 14.0);
-            return val;
-        }
-    } else { // river
-        bool hasPair = false;
-        int pairVal = -1;
-        int highVal = -1;
-        // find if pair exists, remember highest pair (and also remember highest val sans pair)
-        for (int i = 0; i < 7; i++) {
-            if (cards[i].value > highVal) {
-                highVal = cards[i].value;
-            }
-            for (int j = 0; j < 7; j++) {
-                if ((cards[i].value == cards[j]. value) && (i != j)) {
-                    hasPair = true;
-                    if (cards[i].value > pairVal) {
-                        pairVal = cards[i].value;
-                    }
-                }
-            }
-        }
-        if (hasPair) { // if a pair exists
-            if (pairVal == 14) { // if aces
-                return 2.5;
-            } else if (pairVal == 13) { // if kings
-                return 2.25;
-            } else if (pairVal == 12) { // if queens
-                return 2.0;
-            } else { // anything lower
-                float val = (float)((pairVal / 14.0)*1.5);
-                return val;
-            }
-        } else {
-            // if no pair, just return highVal, normalized across 1 according to all possible card values (2 - 14)
-            float val = (float)(highVal / 14.0);
-            return val;
-        }
-    }
-    return 0.0;
-}
-
-// Determines how likely it is for the input cards to achieve a straight flush
-float AI::determineStraightFlushOdds(Card* cards, int betRound) {
-    // flop
-    if (betRound == 1) {
-        float bestVal = 0.0;
-        for (int i = 0; i < 5; i++) { // test each card as top card of straight flush
-            for (int j = 0; j < 5; j++) { // see if first card below exists
-                if ((cards[j].value == cards[i].value - 1) && (cards[j].suit == cards[i].suit)) {
-                    for (int k = 0; k < 5; k++) { // see if second card below exists
-                        if ((cards[k].value == cards[i].value - 2) && (cards[k].suit == cards[i].suit)) {
-                            if (bestVal < 0.4) {
-                                bestVal = 0.4;
-                            }
-                            for (int l = 0; l < 5; l++) { // see if third cards below exists
-                                if ((cards[l].value == cards[i].value - 3) && (cards[l].suit == cards[i].suit)) {
-                                    if (bestVal < 0.7) {
-                                        bestVal = 0.7;
-                                    }
-                                    for (int m = 0; m < 5; m++) { // see if straight flush is already made
-                                        if ((cards[m].value == cards[i].value - 4) && (cards[m].suit == cards[i].suit)) {
-                                            if (bestVal < 7.0) {
-                                                bestVal = 7.0;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        return bestVal;
-    }
-    // turn
-    else if (betRound == 2) {
-        float bestVal = 0.0;
-        for (int i = 0; i < 6; i++) { // test each card as top card of straight flush
-            for (int j = 0; j < 6; j++) { // see if first card below exists
-                if ((cards[j].value == cards[i].value - 1) && (cards[j].suit == cards[i].suit)) {
-                    for (int k = 0; k < 6; k++) { // see if second card below exists
-                        if ((cards[k].value == cards[i].value - 2) && (cards[k].suit == cards[i].suit)) {
-                            for (int l = 0; l < 6; l++) { // see if third cards below exists
-                                if ((cards[l].value == cards[i].value - 3) && (cards[l].suit == cards[i].suit)) {
-                                    if (bestVal < 0.6) {
-                                        bestVal = 0.6;
-                                    }
-                                    for (int m = 0; m < 6; m++) { // see if straight flush is already made
-                                        if ((cards[m].value == cards[i].value - 4) && (cards[m].suit == cards[i].suit)) {
-                                            if (bestVal < 7.0) {
-                                                bestVal = 7.0;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        return bestVal;
-    }
-    // river
-    else {
-        float bestVal = 0.0;
-        for (int i = 0; i < 7; i++) { // test each card as top card of straight flush
-            for (int j = 0; j < 7; j++) { // see if first card below exists
-                if ((cards[j].value == cards[i].value - 1) && (cards[j].suit == cards[i].suit)) {
-                    for (int k = 0; k < 7; k++) { // see if second card below exists
-                        if ((cards[k].value == cards[i].value - 2) && (cards[k].suit == cards[i].suit)) {
-                            for (int l = 0; l < 7; l++) { // see if third cards below exists
-                                if ((cards[l].value == cards[i].value - 3) && (cards[l].suit == cards[i].suit)) {
-                                    for (int m = 0; m < 7; m++) { // see if straight flush is already made
-                                        if ((cards[m].value == cards[i].value - 4) && (cards[m].suit == cards[i].suit)) {
-                                            if (bestVal < 7.0) {
-                                                bestVal = 7.0;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        return bestVal;
-    }
-    return 0.0;
-}
-
-// Determines how likely it is for the input cards to achieve a four of a kind
-float AI::determineFourOfAKindOdds(Card* cards, int betRound) {
-    // flop
-    if (betRound == 1) {
-        int numSame = 1;
-        for (int i = 0; i < 5; i++) { // test each card as base of four of a kind
-            for (int j = 0; j < 5; j++) { // look for second card
-                if ((cards[j].value == cards[i].value) && (j != i)) {
-                    // if another card of same value in hand, but not same as first
-                    if (numSame < 2) {
-                        numSame = 2;
-                    }
-                    for (int k = 0; k < 5; k++) { // look for third card
-                        if ((cards[k].value == cards[i].value) && (k != i) && (k != j)) {
-                            // if another card of same value in hand, but not same as first/second
-                            if (numSame < 3) {
-                                numSame = 3;
-                            }
-                            for (int l = 0; l < 5; l++) { // look for fourth card
-                                if ((cards[l].value == cards[i].value) && (l != i) && (l != j) && (l != k)) {
-                                    // if another card of same value in hand, but not same as first/second/third
-                                    if (numSame < 4) {
-                                        numSame = 4;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        if (numSame == 4) { // if made four of a kind
-            return 6.5;
-        } else if (numSame == 3) { // if one card away
-            return 0.7;
-        } else if (numSame == 2) { // if two away
-            return 0.4;
-        } else { // else four of a kind not possible
-            return 0.0;
-        }
-    }
-    // turn
-    else if (betRound == 2) {
-        int numSame = 1;
-        for (int i = 0; i < 6; i++) { // test each card as base of four of a kind
-            for (int j = 0; j < 6; j++) { // look for second card
-                if ((cards[j].value == cards[i].value) && (j != i)) {
-                    // if another card of same value in hand, but not same as first
-                    if (numSame < 2) {
-                        numSame = 2;
-                    }
-                    for (int k = 0; k < 6; k++) { // look for third card
-                        if ((cards[k].value == cards[i].value) && (k != i) && (k != j)) {
-                            // if another card of same value in hand, but not same as first/second
-                            if (numSame < 3) {
-                                numSame = 3;
-                            }
-                            for (int l = 0; l < 6; l++) { // look for fourth card
-                                if ((cards[l].value == cards[i].value) && (l != i) && (l != j) && (l != k)) {
-                                    // if another card of same value in hand, but not same as first/second/third
-                                    if (numSame < 4) {
-                                        numSame = 4;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        if (numSame == 4) { // if made four of a kind
-            return 6.5;
-        } else if (numSame == 3) { // if one card away
-            return 0.6;
-        } else { // else four of a kind not possible
-            return 0.0;
-        }
-    }
-    // river
-    else {
-        int numSame = 1;
-        for (int i = 0; i < 7; i++) { // test each card as base of four of a kind
-            for (int j = 0; j < 7; j++) { // look for second card
-                if ((cards[j].value == cards[i].value) && (j != i)) {
-                    // if another card of same value in hand, but not same as first
-                    if (numSame < 2) {
-                        numSame = 2;
-                    }
-                    for (int k = 0; k < 7; k++) { // look for third card
-                        if ((cards[k].value == cards[i].value) && (k != i) && (k != j)) {
-                            // if another card of same value in hand, but not same as first/second
-                            if (numSame < 3) {
-                                numSame = 3;
-                            }
-                            for (int l = 0; l < 7; l++) { // look for fourth card
-                                if ((cards[l].value == cards[i].value) && (l != i) && (l != j) && (l != k)) {
-                                    // if another card of same value in hand, but not same as first/second/third
-                                    if (numSame < 4) {
-                                        numSame = 4;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        if (numSame == 4) { // if made four of a kind
-            return 6.5;
-        } else { // else four of a kind not possible
-            return 0.0;
-        }
-    }
-    return 0.0;
-}
-
-// Determines how likely it is for the input cards to achieve a full house
-float AI::determineFullHouseOdds(Card* cards, int betRound) {
-    // flop
-    if (betRound == 1) {
-        // first find most common val
-        int mostCommonVal = -1;
-        int mostFreq = 1;
-        for (int i = 0; i < 5; i++) {
-            int freq = 1;
-            for (int j = 0; j < 5; j++) {
-                if ((cards[i].value == cards[j].value) && (i != j)) {
-                    freq += 1;
-                }
-            }
-            if (freq > mostFreq) {
-                mostFreq = freq;
-                mostCommonVal = cards[i].value;
-            }
+        if (verbose) {
+            cout << "Daniel puts in $" << bet << ", going all in!" << endl;
         }
-        // then find second most freq
-        int secondMostCommonVal = -1;
-        int secondMostFreq = 1;
-        for (int i = 0; i < 5; i++) {
-            if (cards[i].value != mostCommonVal) {
-                int freq = 1;
-                for (int j = 0; j < 5; j++) {
-                    if ((cards[i].value == cards[j].value) && (i != j)) {
-                        freq += 1;
-                    }
-                }
-                if (freq > secondMostFreq) {
-                    secondMostFreq = freq;
-                    secondMostCommonVal = cards[i].value;
-                }
-            }
-        }
-        if (mostFreq >= 3) {
-            if (secondMostFreq >= 2) { // made full house
-                return 6.0;
-            } else { // have 3 and 1
-                return 0.7;
-            }
-        } else if (mostFreq == 2) {
-            if (secondMostFreq == 2) { // have 2 and 2
-                return 1.0;
-            } else { // have 2 and 1
-                return 0.4;
-            }
-        } else { // 1 and 1 (nothing)
-            return 0.0;
-        }
-    }
-    // turn
-    else if (betRound == 2) {
-        // first find most common val
-        int mostCommonVal = -1;
-        int mostFreq = 1;
-        for (int i = 0; i < 6; i++) {
-            int freq = 1;
-            for (int j = 0; j < 6; j++) {
-                if ((cards[i].value == cards[j].value) && (i != j)) {
-                    freq += 1;
-                }
-            }
-            if (freq > mostFreq) {
-                mostFreq = freq;
-                mostCommonVal = cards[i].value;
-            }
-        }
-        // then find second most freq
-        int secondMostCommonVal = -1;
-        int secondMostFreq = 1;
-        for (int i = 0; i < 6; i++) {
-            if (cards[i].value != mostCommonVal) {
-                int freq = 1;
-                for (int j = 0; j < 6; j++) {
-                    if ((cards[i].value == cards[j].value) && (i != j)) {
-                        freq += 1;
-                    }
-                }
-                if (freq > secondMostFreq) {
-                    secondMostFreq = freq;
-                    secondMostCommonVal = cards[i].value;
-                }
-            }
-        }
-        if (mostFreq >= 3) {
-            if (secondMostFreq >= 2) { // made full house
-                return 6.0;
-            } else { // have 3 and 1
-                return 0.6;
-            }
-        } else if (mostFreq == 2) {
-            if (secondMostFreq == 2) { // have 2 and 2
-                return 0.9;
-            } else { // have 2 and 1
-                return 0.0;
-            }
-        } else { // 1 and 1 (nothing)
-            return 0.0;
-        }
-    }
-    // river
-    else {
-        // first find most common val
-        int mostCommonVal = -1;
-        int mostFreq = 1;
-        for (int i = 0; i < 7; i++) {
-            int freq = 1;
-            for (int j = 0; j < 7; j++) {
-                if ((cards[i].value == cards[j].value) && (i != j)) {
-                    freq += 1;
-                }
-            }
-            if (freq > mostFreq) {
-                mostFreq = freq;
-                mostCommonVal = cards[i].value;
-            }
-        }
-        // then find second most freq
-        int secondMostCommonVal = -1;
-        int secondMostFreq = 1;
-        for (int i = 0; i < 7; i++) {
-            if (cards[i].value != mostCommonVal) {
-                int freq = 1;
-                for (int j = 0; j < 7; j++) {
-                    if ((cards[i].value == cards[j].value) && (i != j)) {
-                        freq += 1;
-                    }
-                }
-                if (freq > secondMostFreq) {
-                    secondMostFreq = freq;
-                    secondMostCommonVal = cards[i].value;
-                }
-            }
-        }
-        if (mostFreq >= 3) {
-            if (secondMostFreq >= 2) { // made full house
-                return 6.0;
-            } else { // have 3 and 1
-                return 0.0;
-            }
-        } else if (mostFreq == 2) {
-            if (secondMostFreq == 2) { // have 2 and 2
-                return 0.0;
-            } else { // have 2 and 1
-                return 0.0;
-            }
-        } else { // 1 and 1 (nothing)
-            return 0.0;
-        }
-    }
-    return 0.0;
-}
-
-// FLUSH DETERMINATION ABOVE
-
-// STRAIGHT DETERMINATION ABOVE
-
-// Determines how likely it is for the input cards to achieve a three of a kind
-float AI::determineThreeOfAKindOdds(Card* cards, int betRound) {
-    // flop
-    if (betRound == 1) {
-        int numSame = 1;
-        for (int i = 0; i < 5; i++) { // test each card as base of three of a kind
-            for (int j = 0; j < 5; j++) { // look for second card
-                if ((cards[j].value == cards[i].value) && (j != i)) {
-                    // if another card of same value in hand, but not same as first
-                    if (numSame < 2) {
-                        numSame = 2;
-                    }
-                    for (int k = 0; k < 5; k++) { // look for third card
-                        if ((cards[k].value == cards[i].value) && (k != i) && (k != j)) {
-                            // if another card of same value in hand, but not same as first/second
-                            if (numSame < 3) {
-                                numSame = 3;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        if (numSame == 3) { // if made three of a kind
-            return 3.5;
-        } else if (numSame == 2) { // if one away
-            return 1.0;
-        } else { // if no pairs on the flop
-            return 0.5;
-        }
-    }
-    // turn
-    else if (betRound == 2) {
-        int numSame = 1;
-        for (int i = 0; i < 6; i++) { // test each card as base of four of a kind
-            for (int j = 0; j < 6; j++) { // look for second card
-                if ((cards[j].value == cards[i].value) && (j != i)) {
-                    // if another card of same value in hand, but not same as first
-                    if (numSame < 2) {
-                        numSame = 2;
-                    }
-                    for (int k = 0; k < 6; k++) { // look for third card
-                        if ((cards[k].value == cards[i].value) && (k != i) && (k != j)) {
-                            // if another card of same value in hand, but not same as first/second
-                            if (numSame < 3) {
-                                numSame = 3;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        if (numSame == 3) { // if made three of a kind
-            return 3.5;
-        } else if (numSame == 2) { // if one card away
-            return 1.0;
-        } else { // three of a kind not possible
-            return 0.0;
-        }
-    }
-    // river
-    else {
-        int numSame = 1;
-        for (int i = 0; i < 7; i++) { // test each card as base of four of a kind
-            for (int j = 0; j < 7; j++) { // look for second card
-                if ((cards[j].value == cards[i].value) && (j != i)) {
-                    // if another card of same value in hand, but not same as first
-                    if (numSame < 2) {
-                        numSame = 2;
-                    }
-                    for (int k = 0; k < 7; k++) { // look for third card
-                        if ((cards[k].value == cards[i].value) && (k != i) && (k != j)) {
-                            // if another card of same value in hand, but not same as first/second
-                            if (numSame < 3) {
-                                numSame = 3;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        if (numSame == 3) { // if made three of a kind
-            return 3.5;
-        } else { // three of a kind not possible
-            return 0.0;
-        }
-    }
-    return 0.0;
-}
-
-// Determines how likely it is for the input cards to achieve a two pair
-float AI::determineTwoPairOdds(Card* cards, int betRound) {
-    // flop
-    if (betRound == 1) {
-        // first look for first pair
-        int firstVal = -1;
-        int firstFreq = 1;
-        for (int i = 0; i < 5; i++) {
-            for (int j = 0; j < 5; j++) {
-                if ((cards[j].value == cards[i].value) && (i != j)) {
-                    // if same value exists, and not same card as first
-                    firstVal = cards[i].value;
-                    firstFreq = 2;
-                }
-            }
-        }
-        // then look for second pair
-        int secondVal = -1;
-        int secondFreq = 1;
-        for (int i = 0; i < 5; i++) {
-            if (cards[i].value != firstVal) {
-                // look for second pair, but ignore card if same value as first pair found
-                for (int j = 0; j < 5; j++) {
-                    if ((cards[j].value == cards[i].value) && (i != j)) {
-                        // if same value exists, and not same card as first
-                        secondVal = cards[i].value;
-                        secondFreq = 2;
-                    }
-                }
-            }
-        }
-        if (firstFreq == 2) {
-            if (secondFreq == 2) { // two pair made
-                return 2.75;
-            } else { // 2, 1
-                return 0.7;
-            }
-        } else { // 1, 1
-            return 0.3;
-        }
-    }
-    // turn
-    else if (betRound == 2) {
-        // first look for first pair
-        int firstVal = -1;
-        int firstFreq = 1;
-        for (int i = 0; i < 6; i++) {
-            for (int j = 0; j < 6; j++) {
-                if ((cards[j].value == cards[i].value) && (i != j)) {
-                    // if same value exists, and not same card as first
-                    firstVal = cards[i].value;
-                    firstFreq = 2;
-                }
-            }
-        }
-        // then look for second pair
-        int secondVal = -1;
-        int secondFreq = 1;
-        for (int i = 0; i < 6; i++) {
-            if (cards[i].value != firstVal) {
-                // look for second pair, but ignore card if same value as first pair found
-                for (int j = 0; j < 6; j++) {
-                    if ((cards[j].value == cards[i].value) && (i != j)) {
-                        // if same value exists, and not same card as first
-                        secondVal = cards[i].value;
-                        secondFreq = 2;
-                    }
-                }
-            }
-        }
-        if (firstFreq == 2) {
-            if (secondFreq == 2) { // two pair made
-                return 2.75;
-            } else { // 2, 1
-                return 0.6;
-            }
-        } else { // 1, 1
-            return 0.0;
-        }
-    }
-    // river
-    else {
-        // first look for first pair
-        int firstVal = -1;
-        int firstFreq = 1;
-        for (int i = 0; i < 7; i++) {
-            for (int j = 0; j < 7; j++) {
-                if ((cards[j].value == cards[i].value) && (i != j)) {
-                    // if same value exists, and not same card as first
-                    firstVal = cards[i].value;
-                    firstFreq = 2;
-                }
-            }
-        }
-        // then look for second pair
-        int secondVal = -1;
-        int secondFreq = 1;
-        for (int i = 0; i < 7; i++) {
-            if (cards[i].value != firstVal) {
-                // look for second pair, but ignore card if same value as first pair found
-                for (int j = 0; j < 7; j++) {
-                    if ((cards[j].value == cards[i].value) && (i != j)) {
-                        // if same value exists, and not same card as first
-                        secondVal = cards[i].value;
-                        secondFreq = 2;
-                    }
-                }
-            }
-        }
-        if (firstFreq == 2) {
-            if (secondFreq == 2) { // two pair made
-                return 2.75;
-            } else { // 2, 1
-                return 0.0;
-            }
-        } else { // 1, 1
-            return 0.0;
+    } else {
+        if (verbose) {
+            cout << "Daniel raises to $" << currBet+bet << "." << endl;
         }
     }
-    return 0.0;
+    return bet;
 }
 
-// PAIR DETERMINATION ABOVE
-
-
 
 
 // Function for resetting the user's range
 // This will happen at the beginning of the hand, restoring the user's possible hands to all 1326 possiblities
 void AI::resetUserRange() {
-    int x = 0;
-    for (int i = 0; i < 52; i++) {
-        for (int j = i + 1; j < 52; j++) {
-            userRange[x][0] = i;
-            userRange[x][1] = j;
-            handStrengths[x] = 0.0;
-            x += 1;
-        }
-    }
-    possibleUserHands = 1326;
+    range.reset();
 }
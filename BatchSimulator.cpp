@@ -0,0 +1,143 @@
+//
+//  BatchSimulator.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+#include <vector>
+using namespace std;
+
+
+// Results of a batch of all in deals, from the user's point of view
+struct EquityResult {
+    long long deals;
+    long long userWins;
+    long long AIWins;
+    long long ties;
+    double userEquity; // share of the pot the user wins on average (a tie is worth half the pot)
+};
+
+
+// BatchSimulator Class
+// Runs all in showdowns (e.g. for equity runs of hundreds of millions of deals) in batches instead of one table at a time.
+// Every batch goes through three stages, each one a simple loop over structure-of-arrays buffers:
+//  1. deal: fill in the missing cards (the rest of the board, and any unknown hole cards) for every deal in the batch
+//  2. evaluate: rank both players' seven card hands for every deal, with the hand evaluator
+//  3. settle: compare the ranks and add up who won every deal
+// Keeping each stage in its own loop keeps the working set of each stage small and hot in cache,
+// and leaves the compiler with tight, branch-light loops (the settle stage vectorizes).
+class BatchSimulator {
+public:
+    int batchSize;
+    Rng rng;
+    // the structure-of-arrays buffers, one entry per deal in the batch
+    vector<uint64_t> userCards; // the user's seven cards, as CardSet bits
+    vector<uint64_t> AICards; // the AI's seven cards, as CardSet bits
+    vector<int> userRanks;
+    vector<int> AIRanks;
+    // Overload constructor
+    BatchSimulator(int size, uint64_t seed) : userCards(size), AICards(size), userRanks(size), AIRanks(size) {
+        batchSize = size;
+        rng.seed(seed);
+    }
+    EquityResult runAllIn(Card* userHand, Card* AIHand, Card* boardCards, int numBoardCards, long long numDeals);
+    void dealBatch(int numDeals, CardSet userKnown, CardSet AIKnown, int userMissing, int AIMissing, int boardMissing, int* liveCards, int numLive);
+    void evaluateBatch(int numDeals);
+    void settleBatch(int numDeals, EquityResult& result);
+};
+
+
+// Function for running numDeals all in showdowns
+// userHand and AIHand are each two cards, or NULL for a random hand; boardCards holds the numBoardCards cards
+// already on the board (0 - 5).  Everything that is unknown is dealt at random for every deal.
+EquityResult BatchSimulator::runAllIn(Card* userHand, Card* AIHand, Card* boardCards, int numBoardCards, long long numDeals) {
+    EquityResult result = {0, 0, 0, 0, 0.0};
+    CardSet board = CardSet::fromCards(boardCards, numBoardCards);
+    CardSet userKnown = board;
+    CardSet AIKnown = board;
+    int userMissing = 2, AIMissing = 2;
+    if (userHand != NULL) {
+        userKnown = userKnown | CardSet::fromCards(userHand, 2);
+        userMissing = 0;
+    }
+    if (AIHand != NULL) {
+        AIKnown = AIKnown | CardSet::fromCards(AIHand, 2);
+        AIMissing = 0;
+    }
+    // the cards that can still be dealt
+    CardSet dead = userKnown | AIKnown;
+    int liveCards[52];
+    int numLive = 0;
+    for (int id = 0; id < 52; id++) {
+        if (!dead.contains(id)) {
+            liveCards[numLive] = id;
+            numLive += 1;
+        }
+    }
+    for (long long done = 0; done < numDeals; done += batchSize) {
+        int thisBatch = (numDeals - done < batchSize) ? (int)(numDeals - done) : batchSize;
+        dealBatch(thisBatch, userKnown, AIKnown, userMissing, AIMissing, 5 - numBoardCards, liveCards, numLive);
+        evaluateBatch(thisBatch);
+        settleBatch(thisBatch, result);
+    }
+    if (result.deals > 0) {
+        result.userEquity = ((double)result.userWins + 0.5 * (double)result.ties) / (double)result.deals;
+    }
+    return result;
+}
+
+
+// Stage 1: deals the missing cards of every deal in the batch
+// Uses a partial Fisher-Yates shuffle of the live cards for every deal (see GameManager::drawCard); since every step
+// picks uniformly among the cards not yet picked for this deal, the order left behind by the last deal doesn't matter
+void BatchSimulator::dealBatch(int numDeals, CardSet userKnown, CardSet AIKnown, int userMissing, int AIMissing, int boardMissing, int* liveCards, int numLive) {
+    int numMissing = userMissing + AIMissing + boardMissing;
+    for (int d = 0; d < numDeals; d++) {
+        uint64_t userBits = userKnown.bits;
+        uint64_t AIBits = AIKnown.bits;
+        for (int i = 0; i < numMissing; i++) {
+            int pick = i + rng.nextInt(numLive - i);
+            int id = liveCards[pick];
+            liveCards[pick] = liveCards[i];
+            liveCards[i] = id;
+            uint64_t bit = (uint64_t)1 << id;
+            if (i < userMissing) { // the user's hole cards
+                userBits |= bit;
+            } else if (i < userMissing + AIMissing) { // the AI's hole cards
+                AIBits |= bit;
+            } else { // board cards go to both hands
+                userBits |= bit;
+                AIBits |= bit;
+            }
+        }
+        userCards[d] = userBits;
+        AICards[d] = AIBits;
+    }
+}
+
+
+// Stage 2: ranks both hands of every deal in the batch
+void BatchSimulator::evaluateBatch(int numDeals) {
+    for (int d = 0; d < numDeals; d++) {
+        userRanks[d] = evaluateHand(CardSet(userCards[d]));
+    }
+    for (int d = 0; d < numDeals; d++) {
+        AIRanks[d] = evaluateHand(CardSet(AICards[d]));
+    }
+}
+
+
+// Stage 3: decides every deal in the batch and adds the results to the running totals
+void BatchSimulator::settleBatch(int numDeals, EquityResult& result) {
+    long long userWins = 0, AIWins = 0;
+    for (int d = 0; d < numDeals; d++) {
+        userWins += (userRanks[d] > AIRanks[d]);
+        AIWins += (userRanks[d] < AIRanks[d]);
+    }
+    result.deals += numDeals;
+    result.userWins += userWins;
+    result.AIWins += AIWins;
+    result.ties += numDeals - userWins - AIWins;
+}
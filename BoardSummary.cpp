@@ -0,0 +1,279 @@
+//
+//  BoardSummary.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+using namespace std;
+
+
+// ------  BOARD SUMMARY ------
+
+// The AI's hand strength heuristics (how close a hand is to a flush, a straight, a good pair, ...) only ever look at how
+// many cards there are of each suit and of each value, and at which values are present (overall and within each suit).
+// Those counts are the same for the board part of every hand the user could have, so the board is summarized once per
+// street, and each hand's summary is just the board's plus its two hole cards.  All eight scores are then read off of
+// the summary at once with a few mask operations (see scoreHeuristics), instead of eight functions each re-scanning the
+// cards with nested loops.
+//
+// Every score matches the original nested loop heuristics exactly, down to the last bit of the float, including for
+// hands that share a card with the board (the heuristics count such a card twice, and so does the summary).
+
+// BoardSummary struct
+// A summary of a set of cards: the board, or the board plus a hand
+struct BoardSummary {
+    int numCards;
+    int firstValues[2]; // the values of the first two cards added, in order (only the pre-flop straight score needs the order)
+    unsigned char valueCounts[15]; // how many cards there are of each value (2 - 14)
+    int atLeast[5]; // atLeast[k] has bit v set if there are at least k cards of value v (k = 1 - 4)
+    unsigned char suitCounts[4]; // how many cards there are of each suit (Hearts, Diamonds, Spades, Clubs)
+    int suitValues[4]; // the values present in each suit, as bitmasks (bit v for value v)
+    // Default constructor, summarizes no cards
+    BoardSummary() {
+        numCards = 0;
+        firstValues[0] = -1;
+        firstValues[1] = -1;
+        for (int v = 0; v < 15; v++) {
+            valueCounts[v] = 0;
+        }
+        for (int k = 0; k < 5; k++) {
+            atLeast[k] = 0;
+        }
+        for (int s = 0; s < 4; s++) {
+            suitCounts[s] = 0;
+            suitValues[s] = 0;
+        }
+    }
+    // Adds a card, given its id (see Card::id)
+    void addCard(int id) {
+        int value = (id % 13) + 2;
+        int suit = id / 13;
+        addValue(value);
+        suitCounts[suit] += 1;
+        suitValues[suit] |= 1 << value;
+    }
+    // Counts one more card of a value
+    void addValue(int value) {
+        if (numCards < 2) {
+            firstValues[numCards] = value;
+        }
+        int count = valueCounts[value];
+        if (count < 4) {
+            atLeast[count + 1] |= 1 << value;
+        }
+        valueCounts[value] = (unsigned char)(count + 1);
+        numCards += 1;
+    }
+    // Returns a copy of this summary with a hand's two cards added
+    BoardSummary withHand(int firstId, int secondId) const {
+        BoardSummary summary = *this;
+        summary.addCard(firstId);
+        summary.addCard(secondId);
+        return summary;
+    }
+};
+
+// Function for summarizing the board cards that are out on a given street (3 on the flop, 4 on the turn, 5 on the river)
+BoardSummary summarizeBoard(Card* boardCards, int betRound) {
+    BoardSummary summary;
+    for (int i = 0; i < betRound + 2; i++) {
+        summary.addCard(boardCards[i].id());
+    }
+    return summary;
+}
+
+// Finds runs of length consecutive values in a value mask
+// Returns a mask with bit v set where values v, v-1, ..., v-(length-1) are all in the mask
+int runsOfLength(int valueMask, int length) {
+    int runs = valueMask;
+    for (int i = 1; i < length; i++) {
+        runs &= valueMask >> i;
+    }
+    return runs;
+}
+
+// The scores of the eight hand strength heuristics
+struct HeuristicScores {
+    float flush;
+    float straight;
+    float goodPair;
+    float straightFlush;
+    float fourOfAKind;
+    float fullHouse;
+    float threeOfAKind;
+    float twoPair;
+};
+
+// Function for working out all eight heuristic scores of a hand from its summary (the fused heuristic kernel)
+// On the flop, turn, and river (betRound 1 - 3) the summary should hold the hole cards and the board out so far.
+// Pre-flop (betRound 0), the flush, straight and good pair scores use the hole cards only (the first two cards added),
+// and the other five treat pre-flop like the river (pre-flop hand strength only adds up the first three, see
+// heuristicHandStrength)
+HeuristicScores scoreHeuristics(const BoardSummary& summary, int betRound) {
+    HeuristicScores scores;
+    int street = ((betRound == 1) || (betRound == 2)) ? betRound : 3; // everything else is scored like the river
+    int maxSuitCount = 0;
+    int flushRuns = 0; // bit k set if there's a run of k suited cards
+    for (int s = 0; s < 4; s++) {
+        if (summary.suitCounts[s] > maxSuitCount) {
+            maxSuitCount = summary.suitCounts[s];
+        }
+        if (summary.suitCounts[s] < 3) { // too few cards in this suit for even the shortest run
+            continue;
+        }
+        for (int length = 3; length <= 5; length++) {
+            if (runsOfLength(summary.suitValues[s], length) != 0) {
+                flushRuns |= 1 << length;
+            }
+        }
+    }
+    int valueMask = summary.atLeast[1];
+    int pairMask = summary.atLeast[2];
+    int numPairs = __builtin_popcount(pairMask);
+    int maxCount = (summary.atLeast[4] != 0) ? 4 : ((summary.atLeast[3] != 0) ? 3 : ((pairMask != 0) ? 2 : 1));
+
+    if (betRound == 0) {
+        // pre-flop flush, straight, and good pair look at the two hole cards alone
+        int firstVal = summary.firstValues[0], secondVal = summary.firstValues[1];
+        scores.flush = (maxSuitCount == 2) ? 0.80 : 0.0;
+        int gap = abs(firstVal - secondVal);
+        if (gap == 0) {
+            scores.straight = 0.0;
+        } else if (gap == 1) {
+            scores.straight = 1.0;
+        } else if (gap < 5) {
+            scores.straight = 0.5;
+        } else if (gap > 8) { // an ace can play low, e.g. ace - two (the order of the cards matters here, as in the heuristic)
+            if (firstVal == 14) {
+                firstVal = 1;
+            }
+            if (secondVal == 14) {
+                secondVal = 1;
+            }
+            if ((firstVal - secondVal) == 1) {
+                scores.straight = 1.0;
+            } else if ((firstVal - secondVal) < 5) {
+                scores.straight = 0.5;
+            } else {
+                scores.straight = 0.0;
+            }
+        } else {
+            scores.straight = 0.0;
+        }
+        if (summary.firstValues[0] == summary.firstValues[1]) { // pocket pair
+            int pairVal = summary.firstValues[0];
+            if (pairVal == 14) {
+                scores.goodPair = 5.0;
+            } else if (pairVal == 13) {
+                scores.goodPair = 4.75;
+            } else if (pairVal == 12) {
+                scores.goodPair = 4.5;
+            } else {
+                scores.goodPair = (pairVal / 14.0) * 3.0;
+            }
+        } else {
+            float cardSum = summary.firstValues[0] + summary.firstValues[1];
+            scores.goodPair = (float)(cardSum/27*1.5);
+        }
+    } else {
+        // flush
+        scores.flush = 0.0;
+        if (maxSuitCount >= 5) {
+            scores.flush = 5.0;
+        } else if ((maxSuitCount == 4) && (street <= 2)) {
+            scores.flush = 1.25;
+        } else if ((maxSuitCount == 3) && (street == 1)) {
+            scores.flush = 0.25;
+        }
+        // straight
+        scores.straight = 0.0;
+        if (runsOfLength(valueMask, 5) != 0) {
+            scores.straight = 4.0;
+        } else if ((runsOfLength(valueMask, 4) != 0) && (street <= 2)) {
+            scores.straight = 0.6;
+        } else if ((runsOfLength(valueMask, 3) != 0) && (street == 1)) {
+            scores.straight = 0.4;
+        }
+        // good pair
+        if (pairMask != 0) {
+            int pairVal = 31 - __builtin_clz(pairMask);
+            if (pairVal == 14) {
+                scores.goodPair = 2.5;
+            } else if (pairVal == 13) {
+                scores.goodPair = 2.25;
+            } else if (pairVal == 12) {
+                scores.goodPair = 2.0;
+            } else {
+                scores.goodPair = (float)((pairVal / 14.0)*1.5);
+            }
+        } else {
+            int highVal = (valueMask != 0) ? (31 - __builtin_clz(valueMask)) : -1;
+            scores.goodPair = (float)(highVal / 14.0);
+        }
+    }
+    // straight flush
+    scores.straightFlush = 0.0;
+    if (flushRuns & (1 << 5)) {
+        scores.straightFlush = 7.0;
+    } else if ((flushRuns & (1 << 4)) && (street <= 2)) {
+        scores.straightFlush = (street == 1) ? 0.7 : 0.6;
+    } else if ((flushRuns & (1 << 3)) && (street == 1)) {
+        scores.straightFlush = 0.4;
+    }
+    // four of a kind
+    scores.fourOfAKind = 0.0;
+    if (maxCount == 4) {
+        scores.fourOfAKind = 6.5;
+    } else if ((maxCount == 3) && (street <= 2)) {
+        scores.fourOfAKind = (street == 1) ? 0.7 : 0.6;
+    } else if ((maxCount == 2) && (street == 1)) {
+        scores.fourOfAKind = 0.4;
+    }
+    // full house (a second value with at least two cards, next to the most common value)
+    scores.fullHouse = 0.0;
+    if (maxCount >= 3) {
+        if (numPairs >= 2) {
+            scores.fullHouse = 6.0;
+        } else if (street <= 2) {
+            scores.fullHouse = (street == 1) ? 0.7 : 0.6;
+        }
+    } else if ((maxCount == 2) && (street <= 2)) {
+        if (numPairs >= 2) {
+            scores.fullHouse = (street == 1) ? 1.0 : 0.9;
+        } else if (street == 1) {
+            scores.fullHouse = 0.4;
+        }
+    }
+    // three of a kind
+    scores.threeOfAKind = 0.0;
+    if (maxCount >= 3) {
+        scores.threeOfAKind = 3.5;
+    } else if ((maxCount == 2) && (street <= 2)) {
+        scores.threeOfAKind = 1.0;
+    } else if (street == 1) {
+        scores.threeOfAKind = 0.5;
+    }
+    // two pair
+    scores.twoPair = 0.0;
+    if (numPairs >= 2) {
+        scores.twoPair = 2.75;
+    } else if ((numPairs == 1) && (street <= 2)) {
+        scores.twoPair = (street == 1) ? 0.7 : 0.6;
+    } else if ((numPairs == 0) && (street == 1)) {
+        scores.twoPair = 0.3;
+    }
+    return scores;
+}
+
+// Function for scoring a hand from its summary, the way determineHandStrength does: pre-flop, the flush, straight and good
+// pair scores added up, and after that all eight scores added up (in the same order, so the float sum is the same)
+float heuristicHandStrength(const BoardSummary& summary, int betRound) {
+    HeuristicScores scores = scoreHeuristics(summary, betRound);
+    if (betRound == 0) {
+        return scores.flush + scores.straight + scores.goodPair;
+    }
+    return scores.flush + scores.straight + scores.goodPair + scores.straightFlush +
+        scores.fourOfAKind + scores.fullHouse + scores.threeOfAKind + scores.twoPair;
+}
@@ -6,8 +6,14 @@
 //  Copyright © 2019 JonathanRedwine. All rights reserved.
 //
 
+#include <stdint.h>
+
 
 // Card class
+// Besides its value and suit, every real card has a compact id from 0 to 51:
+//  id = 13*suit + (value - 2), with suits numbered Hearts (0), Diamonds (1), Spades (2), Clubs (3)
+// so e.g. the two of hearts is 0, the ace of hearts is 12, and the ace of clubs is 51.
+// The deck in GameManager is laid out in id order, so a card's id is also its index in the deck.
 class Card {
 public:
     // Cards just have two attributes - value (e.g., 3, 8, Jack(11), Ace(14), and suit (e.g., Hearts (H))
@@ -23,4 +29,163 @@ public:
         value = v;
         suit = s;
     }
+    // Returns this card's id (0 - 51), or -1 if this is a 'dead' card
+    int id() {
+        if (value < 2) {
+            return -1;
+        }
+        if (suit == 'H') {
+            return value - 2;
+        } else if (suit == 'D') {
+            return 13 + value - 2;
+        } else if (suit == 'S') {
+            return 26 + value - 2;
+        }
+        return 39 + value - 2;
+    }
+    // Creates a card from two characters of text, e.g. "As" (ace of spades), "Td" (ten of diamonds) or "7h"
+    // Returns a 'dead' card if the text isn't a card
+    static Card fromText(const char* text) {
+        const char values[] = "23456789TJQKA";
+        const char suits[] = "hdsc";
+        const char suitNames[4] = {'H', 'D', 'S', 'C'};
+        char valueChar = text[0];
+        char suitChar = text[1];
+        if ((valueChar >= 'a') && (valueChar <= 'z')) { // accept e.g. "ks" as well as "Ks"
+            valueChar -= 32;
+        }
+        if ((suitChar >= 'A') && (suitChar <= 'Z')) { // accept e.g. "KS" as well as "Ks"
+            suitChar += 32;
+        }
+        for (int v = 0; v < 13; v++) {
+            for (int s = 0; s < 4; s++) {
+                if ((valueChar == values[v]) && (suitChar == suits[s])) {
+                    return Card(v + 2, suitNames[s]);
+                }
+            }
+        }
+        return Card();
+    }
+    // Creates the card with the given id (0 - 51)
+    static Card fromId(int id) {
+        const char suits[4] = {'H', 'D', 'S', 'C'};
+        return Card((id % 13) + 2, suits[id / 13]);
+    }
+};
+
+
+// CardSet class
+// A set of cards stored as a 64 bit mask, where bit i is set if the card with id i is in the set.
+// Membership, union, intersection and counting are all single instructions, so this is what should be
+// used for checks like "does this hand contain a card that's already been dealt".
+// Because ids are grouped by suit, each suit is a contiguous 13 bit block of the mask (bit 0 of the block is a two,
+// bit 12 is an ace), which makes per suit extraction a shift.
+class CardSet {
+public:
+    uint64_t bits;
+    // Default constructor, creates an empty set
+    CardSet() {
+        bits = 0;
+    }
+    // Overload constructor, creates a set straight from a mask
+    CardSet(uint64_t b) {
+        bits = b;
+    }
+    // Creates a set holding the first numCards cards of the cards array ('dead' cards are skipped)
+    static CardSet fromCards(Card* cards, int numCards) {
+        CardSet set;
+        for (int i = 0; i < numCards; i++) {
+            set.add(cards[i]);
+        }
+        return set;
+    }
+    bool contains(int id) {
+        return (bits >> id) & 1;
+    }
+    bool contains(Card card) {
+        int id = card.id();
+        return (id >= 0) && contains(id);
+    }
+    void add(int id) {
+        bits |= (uint64_t)1 << id;
+    }
+    void add(Card card) {
+        int id = card.id();
+        if (id >= 0) {
+            add(id);
+        }
+    }
+    void remove(int id) {
+        bits &= ~((uint64_t)1 << id);
+    }
+    // Returns true if this set and the other set share at least one card
+    bool intersects(CardSet other) {
+        return (bits & other.bits) != 0;
+    }
+    CardSet operator|(CardSet other) {
+        return CardSet(bits | other.bits);
+    }
+    CardSet operator&(CardSet other) {
+        return CardSet(bits & other.bits);
+    }
+    // Returns the number of cards in the set
+    int count() {
+        return __builtin_popcountll(bits);
+    }
+    // Returns the 13 bit mask of values held in the given suit (0 - 3), bit 0 is a two and bit 12 is an ace
+    int suitMask(int suit) {
+        return (int)((bits >> (13*suit)) & 0x1FFF);
+    }
+    // Returns the 13 bit mask of values held in any suit
+    int valueMask() {
+        return suitMask(0) | suitMask(1) | suitMask(2) | suitMask(3);
+    }
+    // Returns a 4 bit mask of which suits hold the given value (2 - 14), bit 0 is Hearts and bit 3 is Clubs
+    int valueSuits(int value) {
+        int shift = value - 2;
+        return (int)(((bits >> shift) & 1) | (((bits >> (13 + shift)) & 1) << 1) |
+                     (((bits >> (26 + shift)) & 1) << 2) | (((bits >> (39 + shift)) & 1) << 3));
+    }
 };
+
+
+// ComboTable class
+// Lists the 1326 possible two card hands ("combos"), in the same order as the AI's range (see UserRange):
+// (0, 1), (0, 2), ..., (0, 51), (1, 2), ..., (50, 51), where the numbers are card ids
+class ComboTable {
+public:
+    unsigned char cards[1326][2];
+    uint64_t masks[1326]; // the combo's two cards as CardSet bits
+    uint64_t cardCombos[52][21]; // a 1326 bit set per card, with bit x set if combo x holds the card (see UserRange)
+    // Default constructor, fills in every combo
+    ComboTable() {
+        for (int c = 0; c < 52; c++) {
+            for (int w = 0; w < 21; w++) {
+                cardCombos[c][w] = 0;
+            }
+        }
+        int x = 0;
+        for (int i = 0; i < 52; i++) {
+            for (int j = i + 1; j < 52; j++) {
+                cards[x][0] = (unsigned char)i;
+                cards[x][1] = (unsigned char)j;
+                masks[x] = ((uint64_t)1 << i) | ((uint64_t)1 << j);
+                cardCombos[i][x / 64] |= (uint64_t)1 << (x % 64);
+                cardCombos[j][x / 64] |= (uint64_t)1 << (x % 64);
+                x += 1;
+            }
+        }
+    }
+    // Returns the index of the combo holding the two given card ids (in either order)
+    static int index(int first, int second) {
+        if (first > second) {
+            int temp = first;
+            first = second;
+            second = temp;
+        }
+        // 51 + 50 + ... combos start with a lower card than first
+        return first * 51 - first * (first - 1) / 2 + (second - first - 1);
+    }
+};
+
+ComboTable comboTable;
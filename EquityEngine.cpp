@@ -0,0 +1,205 @@
+//
+//  EquityEngine.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+// EquityEngine Class
+// Computes the AI's exact equity (its share of the pot if both players went all in now) against every two card hand
+// the user could have, by enumerating every possible way the rest of the board could run out.
+//
+// The enumeration goes runout by runout: for each runout the AI's hand is ranked once, and then every possible
+// user hand that doesn't use one of the runout's cards is ranked and compared against it.  The runouts are split
+// between threads, each thread adds up wins into its own per hand totals, and the totals are added together at the end.
+//
+// Results are kept per user hand (comboEquity), so after the user's range changes (e.g. hands are removed after a bet)
+// the AI's equity against the new range is just a weighted average, with nothing enumerated again.
+//
+// An enumeration can be cancelled part way through from another thread (e.g. when it's only being worked out ahead of
+// time, and turns out not to be needed) by pointing cancelled at a flag and setting it, or given a deadline to be
+// finished by (e.g. when the AI only has so long to decide), after which it's put aside.  An enumeration that was put
+// aside keeps its totals and where each thread got to, so the next one for the same cards (e.g. the AI's next decision
+// on the same street) picks up where it stopped instead of starting over.
+class EquityEngine {
+public:
+    int numThreads; // 0 means one thread per core
+    float comboEquity[1326]; // the AI's equity against each hand (indexed like the AI's range), -1 if the hand is impossible
+    const atomic<bool>* cancelled; // if not NULL, the enumeration stops as soon as this is set
+    chrono::steady_clock::time_point deadline; // the enumeration stops if it isn't finished by then (max() means never)
+    atomic<bool> interrupted; // set when the enumeration stopped early (cancelled, or out of time)
+    CardSet partialCards; // the known cards of the enumeration that was put aside (empty if there isn't one)
+    int partialThreads; // how many threads it was split between
+    vector<double> partialWins; // its totals so far, per thread (see enumerateRunouts)
+    vector<double> partialCounts;
+    vector<int> partialNextRunout; // the runout each thread stopped at
+    // Default constructor
+    EquityEngine() {
+        numThreads = 0;
+        cancelled = NULL;
+        deadline = chrono::steady_clock::time_point::max();
+        interrupted = false;
+        partialThreads = 0;
+        for (int x = 0; x < 1326; x++) {
+            comboEquity[x] = -1.0;
+        }
+    }
+    bool computeComboEquities(Card* AIHand, Card* boardCards, int numBoardCards);
+    float rangeEquity(const float* weights);
+    bool shouldStop();
+    void enumerateRunouts(CardSet AICards, CardSet board, int* liveCards, int numLive, int numMissing, int firstRunout, int runoutStep, double* wins, double* counts, int* nextRunout);
+};
+
+
+// Function for computing the AI's exact equity against every possible user hand
+// numBoardCards is how many cards are on the board already (0, 3, 4, or 5); the rest are enumerated
+// Fills comboEquity (hands that use one of the known cards are marked -1)
+// Returns false if the enumeration was cancelled or ran out of time (comboEquity is then left as it was, and the work
+// done so far is kept for the next call with the same cards)
+bool EquityEngine::computeComboEquities(Card* AIHand, Card* boardCards, int numBoardCards) {
+    CardSet AICards = CardSet::fromCards(AIHand, 2);
+    CardSet board = CardSet::fromCards(boardCards, numBoardCards);
+    CardSet known = AICards | board;
+    int liveCards[52];
+    int numLive = 0;
+    for (int id = 0; id < 52; id++) {
+        if (!known.contains(id)) {
+            liveCards[numLive] = id;
+            numLive += 1;
+        }
+    }
+    int threads = numThreads;
+    if (threads <= 0) {
+        threads = (int)thread::hardware_concurrency();
+        if (threads <= 0) {
+            threads = 1;
+        }
+    }
+    int numMissing = 5 - numBoardCards;
+    if (numMissing <= 1) { // with one runout or fewer per card there's not enough work to be worth splitting
+        threads = 1;
+    }
+    // every thread gets its own totals, so no two threads ever write to the same memory
+    // (if an enumeration for these cards was put aside, its totals are carried on with instead of starting from 0)
+    if ((known.bits != partialCards.bits) || (threads != partialThreads)) {
+        partialCards = known;
+        partialThreads = threads;
+        partialWins.assign((size_t)threads * 1326, 0.0);
+        partialCounts.assign((size_t)threads * 1326, 0.0);
+        partialNextRunout.assign(threads, 0);
+    }
+    vector<thread> workers;
+    interrupted = false;
+    for (int t = 1; t < threads; t++) {
+        workers.push_back(thread(&EquityEngine::enumerateRunouts, this, AICards, board, liveCards, numLive, numMissing, t, threads, &partialWins[(size_t)t * 1326], &partialCounts[(size_t)t * 1326], &partialNextRunout[t]));
+    }
+    enumerateRunouts(AICards, board, liveCards, numLive, numMissing, 0, threads, &partialWins[0], &partialCounts[0], &partialNextRunout[0]);
+    for (size_t t = 0; t < workers.size(); t++) {
+        workers[t].join();
+    }
+    if (interrupted) {
+        return false;
+    }
+    for (int x = 0; x < 1326; x++) {
+        double totalWins = 0.0, totalCounts = 0.0;
+        for (int t = 0; t < threads; t++) {
+            totalWins += partialWins[(size_t)t * 1326 + x];
+            totalCounts += partialCounts[(size_t)t * 1326 + x];
+        }
+        if ((totalCounts > 0) && ((comboTable.masks[x] & known.bits) == 0)) {
+            comboEquity[x] = (float)(totalWins / totalCounts);
+        } else {
+            comboEquity[x] = -1.0;
+        }
+    }
+    partialCards = CardSet(); // finished, so there's nothing left to pick up
+    return true;
+}
+
+
+// Function run by each thread of computeComboEquities
+// Enumerates every numMissing card runout from liveCards, but only handles the runouts numbered firstRunout,
+// firstRunout + runoutStep, firstRunout + 2*runoutStep, etc.  For each runout and each user hand that's still possible,
+// adds the AI's result (1 win, 0.5 tie, 0 loss) to wins and 1 to counts.  Stops early if the enumeration is cancelled
+// or out of time (see shouldStop).
+// Runouts before *nextRunout were already added in by an earlier call, and are skipped.  *nextRunout is then set to the
+// runout this thread stopped at (or past the last one, if it finished), so the next call can pick up from there.
+void EquityEngine::enumerateRunouts(CardSet AICards, CardSet board, int* liveCards, int numLive, int numMissing, int firstRunout, int runoutStep, double* wins, double* counts, int* nextRunout) {
+    int picks[5] = {0, 1, 2, 3, 4}; // indices into liveCards of the current runout, always increasing
+    int runout = 0;
+    while (true) {
+        if (((runout % runoutStep) == firstRunout) && (runout >= *nextRunout)) {
+            if (shouldStop()) {
+                *nextRunout = runout;
+                interrupted = true;
+                return;
+            }
+            CardSet fullBoard = board;
+            for (int i = 0; i < numMissing; i++) {
+                fullBoard.add(liveCards[picks[i]]);
+            }
+            int AIRank = evaluateHand(fullBoard | AICards);
+            uint64_t unavailable = fullBoard.bits | AICards.bits;
+            for (int x = 0; x < 1326; x++) {
+                if ((comboTable.masks[x] & unavailable) == 0) {
+                    int userRank = evaluateHand(CardSet(fullBoard.bits | comboTable.masks[x]));
+                    if (AIRank > userRank) {
+                        wins[x] += 1.0;
+                    } else if (AIRank == userRank) {
+                        wins[x] += 0.5;
+                    }
+                    counts[x] += 1.0;
+                }
+            }
+        }
+        runout += 1;
+        // move on to the next combination of numMissing live cards
+        int i = numMissing - 1;
+        while ((i >= 0) && (picks[i] == numLive - numMissing + i)) {
+            i -= 1;
+        }
+        if (i < 0) {
+            break;
+        }
+        picks[i] += 1;
+        for (int j = i + 1; j < numMissing; j++) {
+            picks[j] = picks[j-1] + 1;
+        }
+    }
+    *nextRunout = runout; // every runout is done (if another thread stopped early, this thread has nothing to pick up)
+}
+
+
+// Function for checking whether the enumeration has been cancelled, or is past its deadline
+bool EquityEngine::shouldStop() {
+    if ((cancelled != NULL) && cancelled->load(memory_order_relaxed)) {
+        return true;
+    }
+    return (deadline != chrono::steady_clock::time_point::max()) && (chrono::steady_clock::now() >= deadline);
+}
+
+
+// Function for combining comboEquity into the AI's equity against a whole range
+// weights holds how likely the user is to have each hand (indexed like the AI's range, 0 for hands not in the range)
+// Returns the weighted average equity, or 0 if no possible hand has any weight
+float EquityEngine::rangeEquity(const float* weights) {
+    double totalEquity = 0.0, totalWeight = 0.0;
+    for (int x = 0; x < 1326; x++) {
+        if ((weights[x] > 0) && (comboEquity[x] >= 0)) {
+            totalEquity += weights[x] * comboEquity[x];
+            totalWeight += weights[x];
+        }
+    }
+    if (totalWeight <= 0) {
+        return 0.0;
+    }
+    return (float)(totalEquity / totalWeight);
+}
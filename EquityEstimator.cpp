@@ -0,0 +1,126 @@
+//
+//  EquityEstimator.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+using namespace std;
+
+
+// Result of a sampled equity estimate
+struct EquityEstimate {
+    float equity; // the estimated equity, from 0 to 1
+    float standardError; // the estimate's standard error (the true equity is within about 2 of these 95% of the time)
+    long long samples; // how many runouts were sampled
+};
+
+
+// EquityEstimator Class
+// Estimates the AI's equity against a range by sampling, for when enumerating every runout against every hand
+// (see EquityEngine) would take too long, e.g. pre-flop.  Each sample picks a user hand at random (according to the
+// range's weights) and a random runout of the rest of the board, and plays out the showdown.
+// Sampling stops as soon as the estimate is precise enough (its standard error is at most the target error),
+// or the time budget runs out, whichever comes first.  So a caller can ask for e.g. "equity +/- 1% within 5 ms".
+class EquityEstimator {
+public:
+    Rng rng;
+    int minSamples; // never trust the running standard error before this many samples
+    // Default constructor
+    EquityEstimator() {
+        minSamples = 400;
+    }
+    EquityEstimate estimate(Card* AIHand, Card* boardCards, int numBoardCards, const float* weights, float targetError, double timeBudgetMs);
+};
+
+
+// Function for estimating the AI's equity against a range
+// numBoardCards is how many board cards have been dealt (0 - 5), weights holds how likely the user is to have each hand
+// (indexed like the AI's range, 0 for hands not in the range), targetError is the standard error to stop at, and
+// timeBudgetMs is the most time to spend
+// Returns the estimate (with 0 samples if no hand in the range is possible)
+EquityEstimate EquityEstimator::estimate(Card* AIHand, Card* boardCards, int numBoardCards, const float* weights, float targetError, double timeBudgetMs) {
+    EquityEstimate result = {0.0, 0.0, 0};
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    CardSet AICards = CardSet::fromCards(AIHand, 2);
+    CardSet board = CardSet::fromCards(boardCards, numBoardCards);
+    CardSet known = AICards | board;
+    // running totals of the weights of the possible hands, so a hand can be picked by weight with a binary search
+    float cumulativeWeights[1326];
+    int comboIndex[1326];
+    int numCombos = 0;
+    float totalWeight = 0.0;
+    for (int x = 0; x < 1326; x++) {
+        if ((weights[x] > 0) && ((comboTable.masks[x] & known.bits) == 0)) {
+            totalWeight += weights[x];
+            cumulativeWeights[numCombos] = totalWeight;
+            comboIndex[numCombos] = x;
+            numCombos += 1;
+        }
+    }
+    if (numCombos == 0) {
+        return result;
+    }
+    int liveCards[52];
+    int numLive = 0;
+    for (int id = 0; id < 52; id++) {
+        if (!known.contains(id)) {
+            liveCards[numLive] = id;
+            numLive += 1;
+        }
+    }
+    int numMissing = 5 - numBoardCards;
+    double total = 0.0, totalSquared = 0.0;
+    long long samples = 0;
+    while (true) {
+        // check whether to stop every so often (reading the clock on every sample would cost more than the sample)
+        if ((samples % 128) == 0 && (samples >= minSamples)) {
+            double mean = total / samples;
+            double variance = totalSquared / samples - mean * mean;
+            double standardError = sqrt((variance > 0 ? variance : 0) / samples);
+            double elapsedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            if ((standardError <= targetError) || (elapsedMs >= timeBudgetMs)) {
+                result.equity = (float)mean;
+                result.standardError = (float)standardError;
+                break;
+            }
+        }
+        // pick the user's hand according to the range's weights
+        float target = rng.nextFloat() * totalWeight;
+        int pick = (int)(upper_bound(cumulativeWeights, cumulativeWeights + numCombos, target) - cumulativeWeights);
+        if (pick >= numCombos) {
+            pick = numCombos - 1;
+        }
+        uint64_t userCards = comboTable.masks[comboIndex[pick]];
+        // deal the rest of the board from the cards that are left (partial Fisher-Yates, skipping the user's cards)
+        CardSet fullBoard = board;
+        int dealt = 0;
+        int end = numLive;
+        while (dealt < numMissing) {
+            int swapWith = dealt + rng.nextInt(end - dealt);
+            int id = liveCards[swapWith];
+            if ((userCards >> id) & 1) { // the user holds this card, so move it out of the way and pick again
+                end -= 1;
+                liveCards[swapWith] = liveCards[end];
+                liveCards[end] = id;
+                continue;
+            }
+            liveCards[swapWith] = liveCards[dealt];
+            liveCards[dealt] = id;
+            fullBoard.add(id);
+            dealt += 1;
+        }
+        int AIRank = evaluateHand(fullBoard | AICards);
+        int userRank = evaluateHand(CardSet(fullBoard.bits | userCards));
+        double outcome = (AIRank > userRank) ? 1.0 : ((AIRank == userRank) ? 0.5 : 0.0);
+        total += outcome;
+        totalSquared += outcome * outcome;
+        samples += 1;
+    }
+    result.samples = samples;
+    return result;
+}
@@ -0,0 +1,145 @@
+//
+//  EquitySpeculator.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+#include <atomic>
+#include <string.h>
+#include <thread>
+using namespace std;
+
+
+// EquitySpeculator Class
+// Works out the AI's exact equities (see EquityEngine) on a background thread while the user is deciding on a bet, so
+// that when the AI's turn comes they're already there.  It works out, in order:
+//  1. the equities for the cards known now (unless the AI already has them), which the AI needs for its next decision
+//  2. on the flop, the equities for every turn card that could come next (47 of them), one of which the AI will need
+//     on the turn.  (On the turn there's nothing to get ahead on: the AI doesn't use equities on the river.)
+// Each result is kept along with the cards it was worked out for, so the AI only ever takes a result for exactly the
+// cards it has.  As soon as the user bets, the work is cancelled: whatever was finished is kept, and whatever wasn't
+// is thrown away (the AI just works it out itself if it turns out to need it).
+class EquitySpeculator {
+public:
+    EquityEngine engine; // the speculator's own engine, so the AI's results are never touched from the background
+    atomic<bool> cancelled; // set to stop the background work
+    thread worker;
+    bool running; // whether the worker was started and hasn't been joined yet
+    Card AIHand[2]; // the cards the work was started from
+    Card boardCards[5];
+    int numBoardCards;
+    bool needCurrent; // whether the AI still needs the equities for the known cards
+    CardSet currentCards; // the AI's cards and the board cards currentEquity was worked out for (empty if none)
+    float currentEquity[1326];
+    CardSet nextKnown; // the AI's cards and the board cards (before the next card) that nextEquity was worked out for
+    bool nextDone[52]; // whether nextEquity has been worked out for each possible next card
+    float nextEquity[52][1326]; // the AI's equities if each card came next
+    // Default constructor
+    EquitySpeculator() {
+        cancelled = false;
+        running = false;
+        numBoardCards = 0;
+        needCurrent = false;
+        for (int id = 0; id < 52; id++) {
+            nextDone[id] = false;
+        }
+    }
+    // Destructor, makes sure the worker isn't left running
+    ~EquitySpeculator() {
+        stop();
+    }
+    void start(Card* hand, Card* board, int numBoard, bool needCurrentEquities);
+    void stop();
+    bool take(CardSet known, float* comboEquity);
+    void run();
+};
+
+
+// Function for starting the background work for the given hand and board (numBoard is how many board cards are dealt)
+// needCurrentEquities says whether the equities for the cards known now are needed, or the AI already has them
+void EquitySpeculator::start(Card* hand, Card* board, int numBoard, bool needCurrentEquities) {
+    stop();
+    for (int i = 0; i < 2; i++) {
+        AIHand[i] = hand[i];
+    }
+    for (int i = 0; i < 5; i++) {
+        boardCards[i] = board[i];
+    }
+    numBoardCards = numBoard;
+    needCurrent = needCurrentEquities;
+    currentCards = CardSet();
+    CardSet known = CardSet::fromCards(AIHand, 2) | CardSet::fromCards(boardCards, numBoardCards);
+    if (known.bits != nextKnown.bits) { // results for the next card after other cards are no use any more
+        nextKnown = known;
+        for (int id = 0; id < 52; id++) {
+            nextDone[id] = false;
+        }
+    }
+    cancelled = false;
+    engine.cancelled = &cancelled;
+    worker = thread(&EquitySpeculator::run, this);
+    running = true;
+}
+
+
+// Function for cancelling the background work, and waiting for the worker to finish
+// Anything the worker finished before it was cancelled can still be taken
+void EquitySpeculator::stop() {
+    if (running) {
+        cancelled = true;
+        worker.join();
+        running = false;
+    }
+}
+
+
+// Function for taking the equities worked out for the given cards (the AI's cards and the board cards), if there are any
+// Must only be called while the worker is stopped
+// Returns whether comboEquity was filled in
+bool EquitySpeculator::take(CardSet known, float* comboEquity) {
+    if ((currentCards.bits != 0) && (known.bits == currentCards.bits)) {
+        memcpy(comboEquity, currentEquity, sizeof(currentEquity));
+        return true;
+    }
+    CardSet newCard(known.bits & ~nextKnown.bits);
+    if (((known.bits & nextKnown.bits) == nextKnown.bits) && (newCard.count() == 1)) {
+        int id = __builtin_ctzll(newCard.bits);
+        if (nextDone[id]) {
+            memcpy(comboEquity, nextEquity[id], sizeof(nextEquity[id]));
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// Function run by the background worker (see the class comment for what it works out, and in what order)
+void EquitySpeculator::run() {
+    if (needCurrent) {
+        if (!engine.computeComboEquities(AIHand, boardCards, numBoardCards)) {
+            return;
+        }
+        memcpy(currentEquity, engine.comboEquity, sizeof(currentEquity));
+        currentCards = CardSet::fromCards(AIHand, 2) | CardSet::fromCards(boardCards, numBoardCards);
+    }
+    if (numBoardCards != 3) {
+        return;
+    }
+    Card nextBoardCards[5];
+    for (int i = 0; i < 5; i++) {
+        nextBoardCards[i] = boardCards[i];
+    }
+    for (int id = 0; id < 52; id++) {
+        if (nextKnown.contains(id) || nextDone[id]) {
+            continue;
+        }
+        nextBoardCards[3] = Card::fromId(id);
+        if (!engine.computeComboEquities(AIHand, nextBoardCards, 4)) {
+            return;
+        }
+        memcpy(nextEquity[id], engine.comboEquity, sizeof(nextEquity[id]));
+        nextDone[id] = true;
+    }
+}
@@ -0,0 +1,143 @@
+//
+//  FlopCache.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+
+// ------  FLOP STRENGTH CACHE ------
+
+// On the flop, the AI scores every hand the user could have with its hand strength heuristics.  Those scores only
+// depend on the hand and the flop, and don't change when the suits are relabelled, so they can be worked out ahead of
+// time for each of the 1755 canonical flops (see SuitIsomorphism) and saved to a file ("./main --build-flop-cache <file>").
+//
+// The file is a FlopCacheHeader followed by 1755 rows of 1326 floats: row f holds the score of every hand (indexed like
+// the AI's range) on canonical flop f.  Hands that use one of the flop's cards are scored too (they're still in the user's
+// range for the first decision on a new flop), so every lookup matches the heuristics exactly.  Floats are stored in the
+// byte order of the machine that built the file.
+//
+// The file is memory-mapped read-only rather than read in, so the first lookup on a flop only pages in that flop's row,
+// and every process on the machine that opens the same file shares one copy of it in memory.
+
+// Header at the start of a flop cache file
+struct FlopCacheHeader {
+    char magic[4]; // always "FLOP"
+    uint32_t version; // always 1
+    uint32_t numFlops; // always 1755
+    uint32_t numCombos; // always 1326
+};
+
+
+// FlopCache Class
+class FlopCache {
+public:
+    bool loaded; // whether a cache file is mapped
+    const float* strengths; // the rows of the mapped file (just past the header)
+    void* mapping; // the whole mapped file
+    size_t mappingSize;
+    // Default constructor
+    FlopCache() {
+        loaded = false;
+        strengths = NULL;
+        mapping = NULL;
+        mappingSize = 0;
+    }
+    // Destructor
+    ~FlopCache() {
+        close();
+    }
+    bool open(const char* path);
+    void close();
+    const float* flopStrengths(CardSet flop, int* perm);
+    static bool build(const char* path, void (*scoreFlop)(CardSet flop, float* strengths));
+};
+
+
+// Function for mapping a cache file built by build
+// Returns whether the file was mapped (if not, e.g. it doesn't exist or is the wrong size, the cache stays unloaded)
+bool FlopCache::open(const char* path) {
+    close();
+    int file = ::open(path, O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+    struct stat info;
+    size_t expectedSize = sizeof(FlopCacheHeader) + (size_t)1755 * 1326 * sizeof(float);
+    if ((fstat(file, &info) != 0) || ((size_t)info.st_size != expectedSize)) {
+        ::close(file);
+        return false;
+    }
+    void* mapped = mmap(NULL, expectedSize, PROT_READ, MAP_SHARED, file, 0);
+    ::close(file); // the mapping stays valid after the file is closed
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+    const FlopCacheHeader* header = (const FlopCacheHeader*)mapped;
+    if ((memcmp(header->magic, "FLOP", 4) != 0) || (header->version != 1) || (header->numFlops != 1755) || (header->numCombos != 1326)) {
+        munmap(mapped, expectedSize);
+        return false;
+    }
+    mapping = mapped;
+    mappingSize = expectedSize;
+    strengths = (const float*)((const char*)mapped + sizeof(FlopCacheHeader));
+    loaded = true;
+    return true;
+}
+
+
+// Function for unmapping the cache file (if one is mapped)
+void FlopCache::close() {
+    if (mapping != NULL) {
+        munmap(mapping, mappingSize);
+    }
+    loaded = false;
+    strengths = NULL;
+    mapping = NULL;
+    mappingSize = 0;
+}
+
+
+// Function for finding the cached scores for a flop
+// Fills perm with the suit relabelling that turns the flop into its canonical form: the score of hand (a, b) on this
+// flop is the row's entry for hand (permuteCard(a, perm), permuteCard(b, perm))
+// Returns the flop's row of 1326 scores
+const float* FlopCache::flopStrengths(CardSet flop, int* perm) {
+    canonicalSuitPermutation(flop, perm);
+    return strengths + (size_t)suitIsomorphism.flopIndex(flop) * 1326;
+}
+
+
+// Function for building a cache file
+// scoreFlop fills in the 1326 scores for a canonical flop (the same way the AI would score them)
+// Returns whether the whole file was written
+bool FlopCache::build(const char* path, void (*scoreFlop)(CardSet flop, float* strengths)) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        return false;
+    }
+    FlopCacheHeader header;
+    memcpy(header.magic, "FLOP", 4);
+    header.version = 1;
+    header.numFlops = 1755;
+    header.numCombos = 1326;
+    bool written = (fwrite(&header, sizeof(header), 1, file) == 1);
+    float row[1326];
+    for (int f = 0; (f < 1755) && written; f++) {
+        scoreFlop(suitIsomorphism.flopFromIndex(f), row);
+        written = (fwrite(row, sizeof(row), 1, file) == 1);
+    }
+    return (fclose(file) == 0) && written;
+}
+
+
+FlopCache flopCache;
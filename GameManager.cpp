@@ -6,101 +6,136 @@
 //  Copyright © 2019 JonathanRedwine. All rights reserved.
 //
 
+#include <string.h>
 #include "AI.cpp"
 using namespace std;
 
 
 
+// Results of a batch of hands played by GameManager::simulate, from the user seat's point of view
+struct SimulationResult {
+    long long hands;
+    long long userWins;
+    long long AIWins;
+    long long ties;
+    long long userChips; // net chips won (or lost, if negative) by the user seat
+    long long userChipsSquared; // sum over all hands of the square of the user seat's chips won, for the variance
+};
+
+
 // GameManager Class
 // This class handles facilitating the game of Texas Hold 'em.
 // For example, this class holds the deck of Card objects
 // and deals cards at the appropriate time in the game.
 // The class also facilitates betting rounds between the user and the AI,
 // and keeps track of bet sizes, user/AI stack sizes, pot size, etc.
-// The class also determines the winner of hands, analyzing the cards in user's and AI's hands
-// as well as the board cards to determine who has the best hand.
+// The class also describes the hands at showdown to the user.  Deciding who has the best hand
+// is left to the (silent) hand evaluator in HandEvaluator.cpp.
 class GameManager {
 public:
     AI ai;
     Card* deck = new Card[53]; // 53rd card is a "dead" card
     Card* drawnCards = new Card[9]; // 9 cards will be drawn per hand - 2 per player, 5 board cards
+    CardSet drawnSet; // the same cards as drawnCards, as a set for quick membership checks
+    int deckOrder[52]; // a permutation of card ids, the first numDrawn of which have been drawn this hand
+    int numDrawn;
+    Rng rng; // random number generator used for dealing
     int potSize;
     int userStack;
     int AIStack;
     Card* userHand = new Card[2];
     Card* AIHand = new Card[2];
+    // The two seats at the table.  The AI seat is played by the AI object by default, and the user seat
+    // by the user at the console (NULL).  Either can be swapped for any other Player, e.g. for AI vs AI simulations.
+    Player* userPlayer = NULL;
+    Player* AIPlayer = &ai;
+    bool verbose = true; // if false, nothing is written to the console and there are no pauses (headless mode)
+    int lastHandWinner; // who won the last hand: 1 user, 2 AI, 0 tie
     GameManager() {
         initDeck();
+        shuffleDeck();
+        seedRng(0x853C49E6748FEA9BULL);
+    }
+    ~GameManager() {
+        delete[] deck;
+        delete[] drawnCards;
+        delete[] userHand;
+        delete[] AIHand;
     }
     void initDeck();
+    void seedRng(uint64_t seed);
     Card drawCard();
     void shuffleDeck();
     void finishHand(int handWinner, int hand);
+    void setVerbose(bool v);
+    void pause(const char* message);
+    int playHand(int hand);
+    SimulationResult simulate(long long numHands, int startingStack);
     void displayTable();
     int bettingRound(int firstBettor, int bettingRound);
     int userBet(int currBet, int userLastBet);
-    int findBestHand(Card* cards);
-    int findStraightFlush(Card* cards);
-    int findFourOfAKind(Card* cards);
-    int findFullHouse(Card* cards);
-    int findFlush(Card* cards);
-    int findStraight(Card* cards);
-    int findThreeOfAKind(Card* cards);
-    int findTwoPair(Card* cards);
-    int findPair(Card* cards);
-    int resolveTie(int handStrength, Card* userCards, Card* AICards);
-    int resolveTieStraightFlush(Card* userCards, Card* AICards);
-    int resolveTieFourOfAKind(Card* userCards, Card* AICards);
-    int resolveTieFullHouse(Card* userCards, Card* AICards);
-    int resolveTieFlush(Card* userCards, Card* AICards);
-    int resolveTieStraight(Card* userCards, Card* AICards);
-    int resolveTieThreeOfAKind(Card* userCards, Card* AICards);
-    int resolveTieTwoPair(Card* userCards, Card* AICards);
-    int resolveTiePair(Card* userCards, Card* AICards);
-    int resolveTieHighCard(Card* userCards, Card* AICards);
+    void printValueName(int value);
+    void describeHand(HandResult hand);
+    void describeShowdownWinner(int handWinner);
 };
 
 
+// Seeds the game's random number generators
+// The dealer and the AI get separate streams from the same seed, so a game is fully reproducible from its seed
+void GameManager::seedRng(uint64_t seed) {
+    for (int i = 0; i < 52; i++) { // start dealing from a fresh deck order too, so the deals only depend on the seed
+        deckOrder[i] = i;
+    }
+    rng.seed(seed);
+    ai.seed(rng);
+}
+
+
 // Randomly draw a card (that hasn't already been drawn) from the deck of Card objects
+// Draws without replacement in constant time with one step of a Fisher-Yates shuffle:
+// deckOrder[0..numDrawn-1] holds the ids of the cards already drawn, and the rest of deckOrder
+// holds the cards still in the deck, so we just pick one of the remaining ones and swap it to the front
 // Returns the drawn card
 Card GameManager::drawCard() {
-    int keepTrying = 1;
-    Card newCard;
-    Card alreadyDrawnCard;
-    while (keepTrying) { // loop until we find a new, unique card
-        keepTrying = 0; // at beginning of loop, assume new card is unique
-        newCard = deck[rand()%52]; // try new card
-        for (int i = 0; i < 9; i++) { // look through array of already drawn cards
-            alreadyDrawnCard = drawnCards[i];
-            if ((alreadyDrawnCard.value == newCard.value) && (alreadyDrawnCard.suit == newCard.suit)) {
-                keepTrying = 1; // if our new card matches an already drawn card, we must redraw
-            }
-            if ((alreadyDrawnCard.value == -1) && (keepTrying == 0)) { // if we reach "dead" cards with keepTrying = 0, then our newCard is unique
-                drawnCards[i] = newCard; // put new card in drawnCards array
-                return newCard;
-            }
-        }
-    }
-    return deck[52]; // return "dead" card, but this actually should never happen
+    int pick = numDrawn + rng.nextInt(52 - numDrawn); // index of a card still in the deck
+    int id = deckOrder[pick];
+    deckOrder[pick] = deckOrder[numDrawn];
+    deckOrder[numDrawn] = id;
+    drawnCards[numDrawn] = deck[id]; // put new card in the next slot of the drawnCards array
+    drawnSet.add(id);
+    numDrawn += 1;
+    return deck[id];
 }
 
 
 // Shuffles the deck, resetting a hand
-void GameManager::shuffleDeck() { // essentially just clears the already drawn cards array, filling it with "dead" cards
+// Every card goes back into the deck; since drawCard picks uniformly among the remaining cards,
+// the order left behind in deckOrder by the last hand doesn't matter
+void GameManager::shuffleDeck() {
     for (int i = 0; i < 9; i++) {
         drawnCards[i] = deck[52]; // deck[52] is a placeholder "dead" card
     }
+    drawnSet = CardSet();
+    numDrawn = 0;
 }
 
 // Finish the hand, putting appropriate chips in winner's stacks
 void GameManager::finishHand(int handWinner, int hand) {
-    ai.resetUserRange();
+    AIPlayer->resetHand();
+    if (userPlayer != NULL) {
+        userPlayer->resetHand();
+    }
+    lastHandWinner = handWinner;
     if (handWinner == 1) { // if user won the hand
         userStack += potSize; // award user pot
-        cout << "You win the pot of $" << potSize << "." << endl;
+        if (verbose) {
+            cout << "You win the pot of $" << potSize << "." << endl;
+        }
     } else if (handWinner == 2) { // if AI won the hand
         AIStack += potSize; // award AI pot
-        cout << "Daniel wins the pot of $" << potSize << "." << endl;
+        if (verbose) {
+            cout << "Daniel wins the pot of $" << potSize << "." << endl;
+        }
     } else if (handWinner == 0) { // if user and AI tied
         int userWinnings = 0, AIWinnings = 0;
         userWinnings = potSize / 2;
@@ -114,12 +149,200 @@ void GameManager::finishHand(int handWinner, int hand) {
         }
         userStack += userWinnings;
         AIStack += AIWinnings;
-        cout << "You receive $" << userWinnings << "." << endl;
-        cout << "Daniel receives $" << AIWinnings << "." << endl;
+        if (verbose) {
+            cout << "You receive $" << userWinnings << "." << endl;
+            cout << "Daniel receives $" << AIWinnings << "." << endl;
+        }
+    }
+}
+
+
+// Function for turning console output (and the pauses that go with it) on or off for the table and both seats
+// With verbose off, hands are played headless: no console I/O and no sleeping
+void GameManager::setVerbose(bool v) {
+    verbose = v;
+    AIPlayer->verbose = v;
+    if (userPlayer != NULL) {
+        userPlayer->verbose = v;
+    }
+}
+
+
+// Function for pausing the game for dramatic effect, e.g. "Dealing the flop . . ."
+// Does nothing in headless mode
+void GameManager::pause(const char* message) {
+    if (verbose) {
+        cout << message << endl;
+        usleep(500000);
+        for (int i = 0; i < 3; i++) {
+            cout << "." << endl;
+            usleep(500000);
+        }
     }
 }
 
 
+// Function for playing one full hand, from dealing the cards to the showdown
+// hand: which hand number this is (odd means the user is the dealer, even means the AI is the dealer)
+// Returns the winner of the hand: 1 means the user, 2 means the AI, 0 means a tie
+int GameManager::playHand(int hand) {
+    shuffleDeck();
+    if ((hand%2) == 1) { // if user is dealer
+        if (verbose) {
+            cout << "You are the dealer!" << endl;
+        }
+        AIHand[0] = drawCard();
+        userHand[0] = drawCard();
+        AIHand[1] = drawCard();
+        userHand[1] = drawCard();
+        potSize = 3;
+        userStack -= 2;
+        AIStack -= 1;
+    } else { // if AI is dealer
+        if (verbose) {
+            cout << "Daniel is the dealer!" << endl;
+        }
+        userHand[0] = drawCard();
+        AIHand[0] = drawCard();
+        userHand[1] = drawCard();
+        AIHand[1] = drawCard();
+        potSize = 3;
+        userStack -= 1;
+        AIStack -= 2;
+    }
+    pause("Dealing");
+    // betRound: 0 is pre-flop, 1 is flop, 2 is turn, and 3 is river
+    for (int betRound = 0; betRound < 4; betRound++) {
+        if (betRound == 1) {
+            pause("Dealing the flop");
+            drawCard();
+            drawCard();
+            drawCard();
+        } else if (betRound == 2) {
+            pause("Dealing the turn");
+            drawCard();
+        } else if (betRound == 3) {
+            pause("Dealing the river");
+            drawCard();
+        }
+        if (verbose) {
+            cout << endl << "---------------------------------------------" << endl;
+            displayTable();
+        }
+        // if neither player is already all in, have a betting round
+        if ((userStack > 0) && (AIStack > 0)) {
+            if (bettingRound(hand%2, betRound) == -1) { // if a fold happened, the hand is already finished
+                return lastHandWinner;
+            }
+        }
+    }
+    // if no fold happened by the end of the river, showdown
+    Card AIPlayableCards[7];
+    Card userPlayableCards[7];
+    for (int i = 0; i < 5; i++) {
+        AIPlayableCards[i] = drawnCards[i+4];
+        userPlayableCards[i] = drawnCards[i+4];
+    }
+    for (int i = 0; i < 2; i++) {
+        AIPlayableCards[i+5] = AIHand[i];
+        userPlayableCards[i+5] = userHand[i];
+    }
+    HandResult AIResult = analyzeHand(AIPlayableCards, 7);
+    HandResult userResult = analyzeHand(userPlayableCards, 7);
+    // hand ranks include kickers, so comparing them resolves ties as well
+    int handWinner = findShowdownWinner(userResult.rank, AIResult.rank);
+    if (verbose) {
+        cout << endl << "---------------------------------------------" << endl;
+        pause("Showdown!");
+        cout << endl << "Daniel's hand: ";
+        for (int i = 0; i < 2; i++) {
+            if (AIHand[i].value == 10) {
+                cout << "T";
+            } else if (AIHand[i].value == 11) {
+                cout << "J";
+            } else if (AIHand[i].value == 12) {
+                cout << "Q";
+            } else if (AIHand[i].value == 13) {
+                cout << "K";
+            } else if (AIHand[i].value == 14) {
+                cout << "A";
+            } else {
+                cout << AIHand[i].value;
+            }
+            cout << AIHand[i].suit << " ";
+        }
+        cout << endl << "Daniel has: ";
+        describeHand(AIResult);
+        cout << endl << "You have: ";
+        describeHand(userResult);
+        cout << endl;
+        describeShowdownWinner(handWinner);
+    }
+    finishHand(handWinner, hand%2);
+    return handWinner;
+}
+
+
+// Function for playing many hands in a row, as fast as possible (headless mode)
+// Both seats need to be Players (there is no user at the console).  Both stacks are reset to startingStack
+// before every hand, so every hand is independent and nobody ever runs out of money.
+// For the results to only depend on the seed (and not on how busy the machine is), the caller should take away the
+// time budget per decision of both seats first (decisionBudgetMs = 0, see newSimulationOpponent)
+// Returns the results from the user seat's point of view
+SimulationResult GameManager::simulate(long long numHands, int startingStack) {
+    SimulationResult result = {0, 0, 0, 0, 0, 0};
+    setVerbose(false);
+    for (long long h = 1; h <= numHands; h++) {
+        userStack = startingStack;
+        AIStack = startingStack;
+        int handWinner = playHand((int)(h%2));
+        result.hands += 1;
+        if (handWinner == 1) {
+            result.userWins += 1;
+        } else if (handWinner == 2) {
+            result.AIWins += 1;
+        } else {
+            result.ties += 1;
+        }
+        long long chipsWon = userStack - startingStack;
+        result.userChips += chipsWon;
+        result.userChipsSquared += chipsWon * chipsWon;
+    }
+    return result;
+}
+
+
+// Function for checking whether a name is one of the players newSimulationOpponent can make
+bool knownOpponent(const char* name) {
+    return (strcmp(name, "ai") == 0) || (strcmp(name, "random") == 0) || (strcmp(name, "scripted") == 0);
+}
+
+
+// Function for making a player for the user seat of a headless simulation, by name:
+//  "ai": another AI (with no decision time budget, so the simulation only depends on its seed)
+//  "random": a RandomPlayer
+//  "scripted": a ScriptedPlayer that always checks or calls (a "calling station")
+// singleThreaded makes an AI do all of its work on the calling thread (for when every core already has a table)
+// Returns the new player (which the caller deletes), or NULL if the name isn't one of those
+Player* newSimulationOpponent(const char* name, bool singleThreaded) {
+    if (strcmp(name, "ai") == 0) {
+        AI* opponent = new AI();
+        opponent->decisionBudgetMs = 0;
+        if (singleThreaded) {
+            opponent->equityEngine.numThreads = 1;
+            opponent->riverSolver.numThreads = 1;
+        }
+        return opponent;
+    } else if (strcmp(name, "random") == 0) {
+        return new RandomPlayer(0);
+    } else if (strcmp(name, "scripted") == 0) {
+        const int callingStation[1] = {0};
+        return new ScriptedPlayer(callingStation, 1);
+    }
+    return NULL;
+}
+
+
 // Function for hosting a betting round
 // Parameters are the AI, which bettor is first to bet, and the betRound that is happening
 // bettor: 0 means user bets first, 1 means AI bets first
@@ -138,8 +361,24 @@ int GameManager::bettingRound(int bettor, int betRound) {
         currBet = 2;
     }
     while (keepGoing) {
+        Card boardCards[5];
+        for (int i = 0; i < 5; i++) {
+            boardCards[i] = drawnCards[i+4];
+        }
         if ((bettor%2) == 0) { // AI is dealer, user bets first
-            int thisBet = userBet(currBet, userLastBet);
+            int thisBet = 0;
+            if (userStack == 0) { // a player who is already all in just checks
+                thisBet = 0;
+            } else if (userPlayer == NULL) { // if the user is at the console, ask them (the AI thinks ahead meanwhile)
+                AIPlayer->startThinkingAhead(AIHand, boardCards, betRound);
+                thisBet = userBet(currBet, userLastBet);
+                AIPlayer->stopThinkingAhead();
+            } else {
+                thisBet = userPlayer->makeBetDecision(currBet, userLastBet, potSize, userStack, AIStack, userHand, boardCards, betRound, deck, AIHadAction == 1);
+            }
+            if (thisBet > userStack) { // a player can never bet more than they have
+                thisBet = userStack;
+            }
             if (thisBet != -1) { // if the user didn't choose to fold
                 userStack -= thisBet;
                 potSize += thisBet;
@@ -153,22 +392,34 @@ int GameManager::bettingRound(int bettor, int betRound) {
                         AIStack += AILastBet - userLastBet;
                         // and take that much out of the pot
                         potSize -= AILastBet - userLastBet;
-                        cout << "Returning $" << AILastBet - userLastBet << " to Daniel." << endl;
+                        if (verbose) {
+                            cout << "Returning $" << AILastBet - userLastBet << " to Daniel." << endl;
+                        }
                         // set last bets equal
                         AILastBet = userLastBet;
                     }
                 }
+                // if AI is already all in, and user bet more than AI could match
+                if ((AIStack == 0) && (userLastBet > AILastBet)) {
+                    // give user back the difference
+                    userStack += userLastBet - AILastBet;
+                    potSize -= userLastBet - AILastBet;
+                    userLastBet = AILastBet;
+                    currBet = userLastBet;
+                }
             } else { // if the user chose to fold
                 userLastBet = -1;
             }
             userHadAction = 1;
         }
         else { // User is dealer, AI bets first
-            Card* boardCards = new Card[5];
-            for (int i = 0; i < 5; i++) {
-                boardCards[i] = drawnCards[i+4];
+            int thisAIBet = 0;
+            if (AIStack > 0) { // a player who is already all in just checks
+                thisAIBet = AIPlayer->makeBetDecision(currBet, AILastBet, potSize, AIStack, userStack, AIHand, boardCards, betRound, deck, userHadAction == 1);
+            }
+            if (thisAIBet > AIStack) { // a player can never bet more than they have
+                thisAIBet = AIStack;
             }
-            int thisAIBet = ai.makeBetDecision(currBet, AILastBet, potSize, AIStack, userStack, AIHand, boardCards, betRound, deck);
             if (thisAIBet != -1) { // if AI didn't choose to fold
                 AIStack -= thisAIBet;
                 potSize += thisAIBet;
@@ -182,11 +433,21 @@ int GameManager::bettingRound(int bettor, int betRound) {
                         userStack += userLastBet - AILastBet;
                         // and take that much out of the pot
                         potSize -= userLastBet - AILastBet;
-                        cout << "Returning $" << userLastBet - AILastBet << " to player." << endl;
+                        if (verbose) {
+                            cout << "Returning $" << userLastBet - AILastBet << " to player." << endl;
+                        }
                         // set last bets equal
                         userLastBet = AILastBet;
                     }
                 }
+                // if user is already all in, and AI bet more than user could match
+                if ((userStack == 0) && (AILastBet > userLastBet)) {
+                    // give AI back the difference
+                    AIStack += AILastBet - userLastBet;
+                    potSize -= AILastBet - userLastBet;
+                    AILastBet = userLastBet;
+                    currBet = AILastBet;
+                }
             } else { // if the AI chose to fold
                 AILastBet = -1;
             }
@@ -203,7 +464,9 @@ int GameManager::bettingRound(int bettor, int betRound) {
         else if ((userLastBet == AILastBet) && (userHadAction == 1) && (AIHadAction == 1)) { // end hand if same bets and both had action
             keepGoing = 0;
         }
-        cout << "Pot: $" << potSize << endl;
+        if (verbose) {
+            cout << "Pot: $" << potSize << endl;
+        }
     }
     return 1;
 }
@@ -440,1445 +703,112 @@ void GameManager::displayTable() {
 
 
 
-// ------  HAND FINDERS ------
+// ------  HAND DESCRIPTIONS ------
 
+// Hands are evaluated silently by the hand evaluator (see HandEvaluator.cpp).
+// These functions only turn an evaluated hand into text for the interactive game.
 
-// 8 - Straight flush
-// 7 - Four of a kind
-// 6 - Full house
-// 5 - Flush
-// 4 - Straight
-// 3 - Three of a kind
-// 2 - Two pair
-// 1 - Pair
-// 0 - High card
 
-// Function for finding the best hand given seven cards (two hole cards and five board cards)
-// Sequentially looks for hands in descending order of strength (straight flush, then four of a kind, etc)
-// Returns an int referring to the best hand that exists in the seven input cards
-// according to the above values
-int GameManager::findBestHand(Card* cards) {
-    int hand = -1;
-    if ((hand = findStraightFlush(cards)) == 1){
-        return 8;
-    } else if ((hand = findFourOfAKind(cards)) == 1) {
-        return 7;
-    } else if ((hand = findFullHouse(cards)) == 1) {
-        return 6;
-    } else if ((hand = findFlush(cards)) == 1) {
-        return 5;
-    } else if ((hand = findStraight(cards)) == 1) {
-        return 4;
-    } else if ((hand = findThreeOfAKind(cards)) == 1) {
-        return 3;
-    } else if ((hand = findTwoPair(cards)) == 1) {
-        return 2;
-    } else if ((hand = findPair(cards)) == 1) {
-        return 1;
+// Function for printing a card value the way hands are described to the user
+// e.g. 7 -> "7", 11 -> "Jack", 14 -> "Ace"
+void GameManager::printValueName(int value) {
+    if (value < 11) {
+        cout << value;
+    } else if (value == 11) {
+        cout << "Jack";
+    } else if (value == 12) {
+        cout << "Queen";
+    } else if (value == 13) {
+        cout << "King";
     } else {
-        cout << "High card." << endl;
-        return 0;
-    }
-}
-
-// Function for finding if a straight flush exists in a set of seven cards.
-// Returns 1 if one exists, returns -1 if not
-int GameManager::findStraightFlush(Card* cards) {
-    int highest = 0;
-    int highIndex = -1;
-    char highSuit = 'x';
-    for (int h = 0; h < 7; h++) {
-        highest = cards[h].value;
-        highIndex = h;
-        highSuit = cards[h].suit;
-        if (highest >= 5) { // the lowest straight has a high card of 5
-            for (int i = 0; i < 7; i++) {
-                if ((cards[i].value == highest - 1) && (cards[i].suit == highSuit)) { // if second high card in straight flush exists
-                    for (int j = 0; j < 7; j++) {
-                        if ((cards[j].value == highest - 2) && (cards[j].suit == highSuit)) { // if third high card in straight flush exists
-                            for (int k = 0; k < 7; k++) {
-                                if ((cards[k].value == highest - 3) && (cards[k].suit == highSuit)) { // if fourth high card in straight flush exists
-                                    for (int l = 0; l < 7; l++) {
-                                        if ((cards[l].value == highest - 4) && (cards[l].suit == highSuit)) { // if fifth high card in straight flush exists
-                                            cout << "Straight flush! ";
-                                            if (highest < 11) {
-                                                cout << highest;
-                                            } else if (highest == 11) {
-                                                cout << "Jack";
-                                            } else if (highest == 12) {
-                                                cout << "Queen";
-                                            } else if (highest == 13) {
-                                                cout << "King";
-                                            } else {
-                                                cout << "Ace";
-                                            }
-                                            cout << " high." << endl;
-                                            return 1;
-                                        } else if ((highest == 5) && (cards[l].value == 14) && (cards[l].suit == highSuit)) {
-                                            cout << "Straight flush! ";
-                                            if (highest < 11) {
-                                                cout << highest;
-                                            } else if (highest == 11) {
-                                                cout << "Jack";
-                                            } else if (highest == 12) {
-                                                cout << "Queen";
-                                            } else if (highest == 13) {
-                                                cout << "King";
-                                            } else {
-                                                cout << "Ace";
-                                            }
-                                            cout << " high." << endl;
-                                            return 1; // if the straight is ace-5, must check if bottom card is ace (value = 14)
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
-    return -1;
-}
-
-
-// Function for finding if a four of a kind exists in a set of seven cards.
-// Returns 1 if one exists, returns -1 if not
-int GameManager::findFourOfAKind(Card* cards) {
-    int highest = 0;
-    int prevHighest = 15; // set prev highst above possible values
-    int highIndex = -1;
-    while (highest != -1) {
-        for (int i = 0; i < 7; i++) {
-            if ((cards[i].value > highest) && (cards[i].value < prevHighest)) {
-                highest = cards[i].value; // find highest value in cards less than previous highest
-                highIndex = i;
-            }
-        }
-        if (highest == 0) {
-            return -1; // break the loop if we couldn't find a new high card -> that means no four of a kind was found
-        }
-        int numMatches = 0;
-        for (int i = 0; i < 7; i++) {
-            if ((cards[i].value == highest) && (i != highIndex)) {
-                numMatches += 1; // try to find cards that match this card
-            }
-        }
-        if (numMatches == 3) { // if three matches exist, we have a four of a kind
-            cout << "Four of a kind! ";
-            if (highest < 11) {
-                cout << highest;
-            } else if (highest == 11) {
-                cout << "Jack";
-            } else if (highest == 12) {
-                cout << "Queen";
-            } else if (highest == 13) {
-                cout << "King";
-            } else {
-                cout << "Ace";
-            }
-            cout << "s." << endl;
-            return 1;
-        }
-        prevHighest = highest;
-        highest = 0; // reset search variables
-        highIndex = -1;
-    }
-    return -1;
-}
-
-
-// Function for finding if a full house exists in a set of seven cards.
-// Returns 1 if one exists, returns -1 if not
-int GameManager::findFullHouse(Card* cards) {
-    int highest = 0;
-    int prevHighest = 15; // set prev highst above possible values
-    int highIndex = -1;
-    while (highest != -1) {
-        for (int i = 0; i < 7; i++) {
-            if ((cards[i].value > highest) && (cards[i].value < prevHighest)) {
-                highest = cards[i].value; // find highest value in cards less than previous highest
-                highIndex = i;
-            }
-        }
-        if (highest == 0) {
-            return -1; // break the loop if we couldn't find a new high card -> that means no full house was found
-        }
-        int numMatches = 0;
-        for (int i = 0; i < 7; i++) {
-            if ((cards[i].value == highest) && (i != highIndex)) {
-                numMatches += 1; // try to find two other cards that match this card
-            }
-        }
-        if (numMatches == 2) { // if we find that there is a three of a kind, now we look for a different pair
-            int three = highest; // remember the value that has three of a kind
-            highest = 0;
-            prevHighest = 15; // reset search variables
-            highIndex = -1;
-            while (highest != -1) {
-                for (int i = 0; i < 7; i++) {
-                    if ((cards[i].value > highest) && (cards[i].value < prevHighest) && (cards[i].value != three)) {
-                        highest = cards[i].value; // find highest value in cards less than previous highest
-                        highIndex = i;
-                    }
-                }
-                if (highest == 0) { // if no pair was found in addition to the three of a kind, then no full house exists
-                    return -1;
-                }
-                for (int i = 0; i < 7; i++) {
-                    if ((cards[i].value == highest) && (i != highIndex)) { // if we find another pair
-                        cout << "Full house! ";
-                        if (three < 11) {
-                            cout << three;
-                        } else if (three == 11) {
-                            cout << "Jack";
-                        } else if (three == 12) {
-                            cout << "Queen";
-                        } else if (three == 13) {
-                            cout << "King";
-                        } else {
-                            cout << "Ace";
-                        }
-                        cout << "s over ";
-                        if (highest < 11) {
-                            cout << highest;
-                        } else if (highest == 11) {
-                            cout << "Jack";
-                        } else if (highest == 12) {
-                            cout << "Queen";
-                        } else if (highest == 13) {
-                            cout << "King";
-                        } else {
-                            cout << "Ace";
-                        }
-                        cout << "s." << endl;
-                        return 1;
-                    }
-                }
-                prevHighest = highest;
-                highest = 0; // reset search variables
-                highIndex = -1;
-            }
-        }
-        prevHighest = highest;
-        highest = 0; // reset search variables
-        highIndex = -1;
+        cout << "Ace";
     }
-    return -1;
 }
 
 
-// Function for finding if a flush exists in a set of seven cards.
-// Returns 1 if one exists, returns -1 if not
-int GameManager::findFlush(Card* cards) {
-    int numHearts = 0, numDiamonds = 0, numSpades = 0, numClubs = 0;
-    int highHeart = 0, highDiamond = 0, highSpade = 0, highClub = 0;
-    for (int i = 0; i < 7; i++) {
-        if (cards[i].suit == 'H') {
-            numHearts += 1;
-            if (cards[i].value > highHeart) {
-                highHeart = cards[i].value;
-            }
-        } else if (cards[i].suit == 'D') {
-            numDiamonds += 1;
-            if (cards[i].value > highDiamond) {
-                highDiamond = cards[i].value;
-            }
-        } else if (cards[i].suit == 'S') {
-            numSpades += 1;
-            if (cards[i].value > highSpade) {
-                highSpade = cards[i].value;
-            }
-        } else {
-            numClubs += 1;
-            if (cards[i].value > highClub) {
-                highClub = cards[i].value;
-            }
-        }
-    }
-    if (numHearts > 4) {
-        cout << "Flush! Hearts, ";
-        if (highHeart < 11) {
-            cout << highHeart;
-        } else if (highHeart == 11) {
-            cout << "Jack";
-        } else if (highHeart == 12) {
-            cout << "Queen";
-        } else if (highHeart == 13) {
-            cout << "King";
-        } else {
-            cout << "Ace";
-        }
+// Function for describing an evaluated hand to the user
+// e.g. "Full house! Kings over 5s."
+void GameManager::describeHand(HandResult hand) {
+    if (hand.category == 8) {
+        cout << "Straight flush! ";
+        printValueName(hand.values[0]);
         cout << " high." << endl;
-        return 1;
-    } else if (numDiamonds > 4) {
-        cout << "Flush! Diamonds, ";
-        if (highDiamond < 11) {
-            cout << highDiamond;
-        } else if (highDiamond == 11) {
-            cout << "Jack";
-        } else if (highDiamond == 12) {
-            cout << "Queen";
-        } else if (highDiamond == 13) {
-            cout << "King";
+    } else if (hand.category == 7) {
+        cout << "Four of a kind! ";
+        printValueName(hand.values[0]);
+        cout << "s." << endl;
+    } else if (hand.category == 6) {
+        cout << "Full house! ";
+        printValueName(hand.values[0]);
+        cout << "s over ";
+        printValueName(hand.values[1]);
+        cout << "s." << endl;
+    } else if (hand.category == 5) {
+        cout << "Flush! ";
+        if (hand.flushSuit == 'H') {
+            cout << "Hearts, ";
+        } else if (hand.flushSuit == 'D') {
+            cout << "Diamonds, ";
+        } else if (hand.flushSuit == 'S') {
+            cout << "Spades, ";
         } else {
-            cout << "Ace";
+            cout << "Clubs, ";
         }
+        printValueName(hand.values[0]);
         cout << " high." << endl;
-        return 1;
-    } else if (numSpades > 4) {
-        cout << "Flush! Spades, ";
-        if (highSpade < 11) {
-            cout << highSpade;
-        } else if (highSpade == 11) {
-            cout << "Jack";
-        } else if (highSpade == 12) {
-            cout << "Queen";
-        } else if (highSpade == 13) {
-            cout << "King";
-        } else {
-            cout << "Ace";
-        }
+    } else if (hand.category == 4) {
+        cout << "Straight! ";
+        printValueName(hand.values[0]);
         cout << " high." << endl;
-        return 1;
-    } else if (numClubs > 4) {
-        cout << "Flush! Clubs, ";
-        if (highClub < 11) {
-            cout << highClub;
-        } else if (highClub == 11) {
-            cout << "Jack";
-        } else if (highClub == 12) {
-            cout << "Queen";
-        } else if (highClub == 13) {
-            cout << "King";
-        } else {
-            cout << "Ace";
-        }
-        cout << " high." << endl;
-        return 1;
+    } else if (hand.category == 3) {
+        cout << "Three of a kind! ";
+        printValueName(hand.values[0]);
+        cout << "s." << endl;
+    } else if (hand.category == 2) {
+        cout << "Two pair! ";
+        printValueName(hand.values[0]);
+        cout << "s and ";
+        printValueName(hand.values[1]);
+        cout << "s." << endl;
+    } else if (hand.category == 1) {
+        cout << "Pair of ";
+        printValueName(hand.values[0]);
+        cout << "s." << endl;
     } else {
-        return -1;
-    }
-    return -1;
-}
-
-
-// Function for finding if a straight exists in a set of seven cards.
-// Returns 1 if one exists, returns -1 if not
-int GameManager::findStraight(Card* cards) {
-    int highest = 0;
-    int prevHighest = 15; // set prev highest above possible values
-    int highIndex = -1;
-    while (highest != -1) {
-        for (int i = 0; i < 7; i++) {
-            if ((cards[i].value > highest) && (cards[i].value < prevHighest)) {
-                highest = cards[i].value; // find highest value in cards less than previous highest
-                highIndex = i;
-            }
-        }
-        if (highest == 0) {
-            return -1; // break the loop if we couldn't find a new high card -> that means no straight was found
-        }
-        if (highest >= 5) { // the lowest straight has a high card of 5
-            for (int i = 0; i < 7; i++) {
-                if (cards[i].value == highest - 1) { // if second high card in straight exists
-                    for (int j = 0; j < 7; j++) {
-                        if (cards[j].value == highest - 2) { // if third high card in straight exists
-                            for (int k = 0; k < 7; k++) {
-                                if (cards[k].value == highest - 3) { // if fourth high card in straight exists
-                                    for (int l = 0; l < 7; l++) {
-                                        if (cards[l].value == highest - 4) { // if fifth high card in straight exists
-                                            cout << "Straight! ";
-                                            if (highest < 11) {
-                                                cout << highest;
-                                            } else if (highest == 11) {
-                                                cout << "Jack";
-                                            } else if (highest == 12) {
-                                                cout << "Queen";
-                                            } else if (highest == 13) {
-                                                cout << "King";
-                                            } else {
-                                                cout << "Ace";
-                                            }
-                                            cout << " high." << endl;
-                                            return 1;
-                                        } else if ((highest == 5) && (cards[l].value == 14)) {
-                                            cout << "Straight! ";
-                                            if (highest < 11) {
-                                                cout << highest;
-                                            } else if (highest == 11) {
-                                                cout << "Jack";
-                                            } else if (highest == 12) {
-                                                cout << "Queen";
-                                            } else if (highest == 13) {
-                                                cout << "King";
-                                            } else {
-                                                cout << "Ace";
-                                            }
-                                            cout << " high." << endl;
-                                            return 1; // if the straight is ace-5, must check if bottom card is ace (value = 14)
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        prevHighest = highest;
-        highest = 0; // otherwise, reset variables and try again
-        highIndex = -1;
-    }
-    return -1;
-}
-
-
-// Function for finding if a three of a kind exists in a set of seven cards.
-// Returns 1 if one exists, returns -1 if not
-int GameManager::findThreeOfAKind(Card* cards) {
-    int highest = 0;
-    int prevHighest = 15; // set prev highest above possible values
-    int highIndex = -1;
-    while (highest != -1) {
-        for (int i = 0; i < 7; i++) {
-            if ((cards[i].value > highest) && (cards[i].value < prevHighest)) {
-                highest = cards[i].value; // find highest value in cards less than previous highest
-                highIndex = i;
-            }
-        }
-        if (highest == 0) {
-            return -1; // break the loop if we couldn't find a new high card -> that means no three of a kind was found
-        }
-        int n = 0;
-        for (int i = 0; i < 7; i++) { // search if two other cards have same value (ie, three of a kind exists)
-            if ((cards[i].value == highest) && (i != highIndex)) {
-                n += 1; // tally number of matching cards
-            }
-        }
-        if (n == 2) { // if two matches found
-            cout << "Three of a kind! ";
-            if (highest < 11) {
-                cout << highest;
-            } else if (highest == 11) {
-                cout << "Jack";
-            } else if (highest == 12) {
-                cout << "Queen";
-            } else if (highest == 13) {
-                cout << "King";
-            } else {
-                cout << "Ace";
-            }
-            cout << "s." << endl;
-            return 1;
-        }
-        prevHighest = highest;
-        highest = 0; // otherwise, reset variables and try again
-        highIndex = -1;
-    }
-    return -1;
-}
-
-
-// Function for finding if a two pair exists in a set of seven cards.
-// Returns 1 if one exists, returns -1 if not
-int GameManager::findTwoPair(Card* cards) {
-    int highest = 0;
-    int prevHighest = 15; // set prev highest above possible values
-    int highIndex = -1;
-    while (highest != -1) {
-        for (int i = 0; i < 7; i++) {
-            if ((cards[i].value > highest) && (cards[i].value < prevHighest)) {
-                highest = cards[i].value; // find highest value in cards less than previous highest
-                highIndex = i;
-            }
-        }
-        if (highest == 0) {
-            return -1; // break the loop if we couldn't find a new high card -> that means no two pair was found
-        }
-        for (int i = 0; i < 7; i++) {// find if a pair exists for this card
-            if ((cards[i].value == highest) && (i != highIndex)) { // if one is found
-                int secondHighest = 0;
-                int prevSecondHighest = 15; // set up variable to search for second pair
-                int secondHighIndex = -1;
-                while (secondHighest != -1) {
-                    for (int j = 0; j < 7; j++) { // find next highest card
-                        if ((cards[j].value > secondHighest) && (cards[j].value < highest) && (cards[j].value < prevSecondHighest)) {
-                            secondHighest = cards[j].value; // get next highest card not already looked at
-                            secondHighIndex = j;
-                        }
-                    }
-                    for (int j = 0; j < 7; j++) { // find if a pair exists for this second card
-                        if ((cards[j].value == secondHighest) && (j != secondHighIndex)) {
-                            cout << "Two pair! ";
-                            if (highest < 11) {
-                                cout << highest;
-                            } else if (highest == 11) {
-                                cout << "Jack";
-                            } else if (highest == 12) {
-                                cout << "Queen";
-                            } else if (highest == 13) {
-                                cout << "King";
-                            } else {
-                                cout << "Ace";
-                            }
-                            cout << "s and ";
-                            if (secondHighest < 11) {
-                                cout << secondHighest;
-                            } else if (secondHighest == 11) {
-                                cout << "Jack";
-                            } else if (secondHighest == 12) {
-                                cout << "Queen";
-                            } else if (secondHighest == 13) {
-                                cout << "King";
-                            } else {
-                                cout << "Ace";
-                            }
-                            cout << "s." << endl;
-                            return 1;
-                        }
-                    }
-                    if (secondHighest == 0) { // break if no second high card could be found (second pair does not exist)
-                        secondHighest = -1;
-                    } else {
-                        prevSecondHighest = secondHighest;
-                        secondHighest = 0; // otherwise, reset variables and keep looking for second pair
-                        secondHighIndex = -1;
-                    }
-                }
-            }
-        }
-        prevHighest = highest;
-        highest = 0; // keep looking for first pair
-        highIndex = -1;
-    }
-    return -1;
-}
-
-
-// Function for finding if a pair exists in a set of seven cards.
-// Returns 1 if one exists, returns -1 if not
-int GameManager::findPair(Card* cards) {
-    int highest = 0;
-    int prevHighest = 15; // set prev highest above possible values
-    int highIndex = -1;
-    while (highest != -1) {
-        for (int i = 0; i < 7; i++) {
-            if ((cards[i].value > highest) && (cards[i].value < prevHighest)) {
-                highest = cards[i].value; // find highest value in cards less than previous highest
-                highIndex = i;
-            }
-        }
-        if (highest == 0) {
-            return -1; // break the loop if we couldn't find a new high card -> that means we reached the end without finding a pair
-        }
-        for (int i = 0; i < 7; i++) { // find if a pair exists for this card
-            if ((cards[i].value == highest) && (i != highIndex)) {
-                cout << "Pair of ";
-                if (highest < 11) {
-                    cout << highest;
-                } else if (highest == 11) {
-                    cout << "Jack";
-                } else if (highest == 12) {
-                    cout << "Queen";
-                } else if (highest == 13) {
-                    cout << "King";
-                } else {
-                    cout << "Ace";
-                }
-                cout << "s." << endl;
-                return 1; // return 1 if a pair is found
-            }
-        }
-        prevHighest = highest;
-        highest = 0; // otherwise, reset variables and try again
-        highIndex = -1;
-    }
-    return -1;
-}
-
-
-
-
-
-// ------  TIE RESOLVERS ------
-
-// If it's determined that the user and the AI have the same strength of hand (e.g., both have two pair)
-// then the tie must be resolved.
-// The way that the tie is resolved is dependent on the hand that the two players have
-// For example, if both have two pair, first check whose high pair is higher,
-// if same then check whose low pair is higher, if same then check whose fifth card is higher
-// This function returns 1 if the user wins, 2 if the AI wins, and -1 if it's actually still a tie
-int GameManager::resolveTie(int handStrength, Card* userCards, Card* AICards) {
-    if (handStrength == 8) {
-        return resolveTieStraightFlush(userCards, AICards);
-    } else if (handStrength == 7) {
-        return resolveTieFourOfAKind(userCards, AICards);
-    } else if (handStrength == 6) {
-        return resolveTieFullHouse(userCards, AICards);
-    } else if (handStrength == 5) {
-        return resolveTieFlush(userCards, AICards);
-    } else if (handStrength == 4) {
-        return resolveTieStraight(userCards, AICards);
-    } else if (handStrength == 3) {
-        return resolveTieThreeOfAKind(userCards, AICards);
-    } else if (handStrength == 2) {
-        return resolveTieTwoPair(userCards, AICards);
-    } else if (handStrength == 1) {
-        return resolveTiePair(userCards, AICards);
-    } else if (handStrength == 0) {
-        return resolveTieHighCard(userCards, AICards);
-    } else {
-        return -1;
-    }
-}
-
-
-// Function for resolving a tie between two straight flushes
-// Returns 1 if user wins, 2 if AI wins, and 0 if it is a true tie
-int GameManager::resolveTieStraightFlush(Card* userCards, Card* AICards) {
-    int userStraight = 0, AIStraight = 0, userHigh = 0, AIHigh = 0, prevUserHigh = 15, prevAIHigh = 15, userHighIndex = -1, AIHighIndex = -1;
-    char userHighSuit = 'x', AIHighSuit = 'x';
-    for (int h = 0; h < 7; h++) {
-        userHigh = userCards[h].value;
-        userHighSuit = userCards[h].suit;
-        userHighIndex = h;
-        if (userHigh >= 5) { // the lowest straight has a high card of 5
-            for (int i = 0; i < 7; i++) {
-                if ((userCards[i].value == userHigh - 1) && (userCards[i].suit == userHighSuit)) { // if second high card in straight flush exists
-                    for (int j = 0; j < 7; j++) {
-                        if ((userCards[j].value == userHigh - 2) && (userCards[j].suit == userHighSuit)) { // if third high card in straight flush exists
-                            for (int k = 0; k < 7; k++) {
-                                if ((userCards[k].value == userHigh - 3) && (userCards[k].suit == userHighSuit)) { // if fourth high card in straight flush exists
-                                    for (int l = 0; l < 7; l++) {
-                                        if ((userCards[l].value == userHigh - 4) && (userCards[l].suit == userHighSuit)) { // if fifth high card in straight flush exists
-                                            if (userStraight == 0) { // only store if userStraight isn't already found
-                                                userStraight = userHigh; // otherwise, 6 card straight flush would lower
-                                            }
-                                        } else if ((userHigh == 5) && (userCards[l].value == 14) && (userCards[l].suit == userHighSuit)) { // if low card is ace
-                                            if (userStraight == 0) {
-                                                userStraight = userHigh;
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
-    for (int h = 0; h < 7; h++) {
-        AIHigh = AICards[h].value;
-        AIHighSuit = AICards[h].suit;
-        AIHighIndex = h;
-        if (AIHigh >= 5) { // the lowest straight has a high card of 5
-            for (int i = 0; i < 7; i++) {
-                if ((AICards[i].value == AIHigh - 1) && (AICards[i].suit == AIHighSuit)) { // if second high card in straight flush exists
-                    for (int j = 0; j < 7; j++) {
-                        if ((AICards[j].value == AIHigh - 2) && (AICards[j].suit == AIHighSuit)) { // if third high card in straight flush exists
-                            for (int k = 0; k < 7; k++) {
-                                if ((AICards[k].value == AIHigh - 3) && (AICards[k].suit == AIHighSuit)) { // if fourth high card in straight flush exists
-                                    for (int l = 0; l < 7; l++) {
-                                        if ((AICards[l].value == AIHigh - 4) && (AICards[l].suit == AIHighSuit)) { // if fifth high card in straight flush exists
-                                            AIStraight = AIHigh;
-                                            AIHigh = 0; // need to break the loop so we don't lower the straight if 6 card straight exists
-                                        } else if ((AIHigh == 5) && (AICards[l].value == 14) && (AICards[l].suit == AIHighSuit)) { // if low card is ace
-                                            AIStraight = AIHigh;
-                                            AIHigh = 0;
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
-    if (userStraight > AIStraight) {
-        cout << "You win!" << endl;
-        return 1;
-    } else if (userStraight < AIStraight) {
-        cout << "Daniel wins!" << endl;
-        return 2;
-    } else {
-        cout << "Tie!" << endl;
-        return 0;
-    }
-    return 0;
-}
-
-
-// Function for resolving a tie between two four of a kinds
-// Returns 1 if user wins, 2 if AI wins, and 0 if it is a true tie
-int GameManager::resolveTieFourOfAKind(Card* userCards, Card* AICards) {
-    int userFour = 0, AIFour = 0, userHigh = 0, AIHigh = 0, prevUserHigh = 15, prevAIHigh = 15, userHighIndex = -1, AIHighIndex = -1;
-    while (userHigh != -1) { // FIND USER'S FOUR OF A KIND
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh)) {
-                userHigh = userCards[i].value; // find highest value in cards less than previous highest
-                userHighIndex = i;
-            }
-        }
-        int numMatches = 0;
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value == userHigh) && (i != userHighIndex)) {
-                numMatches += 1; // count how many matches this high card has
-            }
-        }
-        if (numMatches == 3) {
-            userFour = userHigh; // if 3 matches, remember this is the four of a kind value
-        }
-        prevUserHigh = userHigh;
-        userHighIndex = -1;
-        if (userHigh != 0) {
-            userHigh = 0;
-        } else {
-            userHigh = -1; // break the loop once all cards have been checked
-        }
-    }
-    while (AIHigh != -1) { // FIND AI'S FOUR OF A KIND
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh)) {
-                AIHigh = AICards[i].value; // find highest value in cards less than previous highest
-                AIHighIndex = i;
-            }
-        }
-        int numMatches = 0;
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value == AIHigh) && (i != AIHighIndex)) {
-                numMatches += 1; // count how many matches this high card has
-            }
-        }
-        if (numMatches == 3) {
-            AIFour = AIHigh;
-        }
-        prevAIHigh = AIHigh;
-        AIHighIndex = -1;
-        if (AIHigh != 0) {
-            AIHigh = 0;
-        } else {
-            AIHigh = -1; // break the loop once all cards have been checked
-        }
-    }
-    if (userFour > AIFour) { // if user's four of a kind is higher than AI's, user wins
-        cout << "You win!" << endl;
-        return 1;
-    } else if (userFour < AIFour) { // if user's four of a kind if lower than AI's, AI wins
-        cout << "Daniel wins!" << endl;
-        return 2;
-    } else { // if four of a kinds are the same, then check fifth card
-        userHigh = 0;
-        AIHigh = 0;
-        for (int i = 0; i < 7; i++) { // find user's and AI's highest card that's not the four of a kind
-            if ((userCards[i].value > userHigh) && (userCards[i].value != userFour)) {
-                userHigh = userCards[i].value;
-            }
-            if ((AICards[i].value > AIHigh) && (AICards[i].value != AIFour)) {
-                AIHigh = AICards[i].value;
-            }
-        }
-        if (userHigh > AIHigh) { // if user's fifth card is higher than AI's, user wins
-            cout << "You win!" << endl;
-            return 1;
-        } else if (userHigh < AIHigh) { // if user's fifth card if lower than AI's, AI wins
-            cout << "Daniel wins!" << endl;
-            return 2;
-        } else { // if they're the same, tie
-            cout << "Tie!" << endl;
-            return 0;
-        }
-    }
-    return 0;
-}
-
-// Function for resolving a tie between two full houses
-// Returns 1 if user wins, 2 if AI wins, and 0 if it is a true tie
-int GameManager::resolveTieFullHouse(Card* userCards, Card* AICards) {
-    int userThree = 0, userTwo = 0, userHigh = 0, AIThree = 0, AITwo = 0, AIHigh = 0, prevUserHigh = 15, prevAIHigh = 15, userHighIndex = -1, AIHighIndex = -1;
-    while (userHigh != -1) { // FIND USER'S FULL HOUSE
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh)) {
-                userHigh = userCards[i].value; // find highest value in cards less than previous highest
-                userHighIndex = i;
-            }
-        }
-        int numMatches = 0;
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value == userHigh) && (i != userHighIndex)) {
-                numMatches += 1; // count how many matches this high card has
-            }
-        }
-        if (numMatches == 2) { // if two matches
-            if (userThree == 0) {
-                userThree = userHigh; // this is set of three
-            } else {
-                userTwo = userHigh; // if three already found (and we just found another set of three), this lower set will be the pair
-            }
-        } else if (numMatches == 1 && (userTwo == 0)) { // if one match (and two not already found), this is the set of two
-            userTwo = userHigh;
-        }
-        prevUserHigh = userHigh;
-        userHighIndex = -1;
-        if (userHigh != 0) {
-            userHigh = 0;
-        } else {
-            userHigh = -1; // break the loop once all cards have been checked
-        }
-    }
-    while (AIHigh != -1) { // FIND AI'S FULL HOUSE
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh)) {
-                AIHigh = AICards[i].value; // find highest value in cards less than previous highest
-                AIHighIndex = i;
-            }
-        }
-        int numMatches = 0;
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value == AIHigh) && (i != AIHighIndex)) {
-                numMatches += 1; // count how many matches this high card has
-            }
-        }
-        if (numMatches == 2) { // if two matches
-            if (AIThree == 0) {
-                AIThree = AIHigh; // this is set of three
-            } else {
-                AITwo = AIHigh; // if three already found (and we just found another set of three), this lower set will be the pair
-            }
-        } else if (numMatches == 1 && (AITwo == 0)) { // if one match (and two not already found), this is the set of two
-            AITwo = AIHigh;
-        }
-        prevAIHigh = AIHigh;
-        AIHighIndex = -1;
-        if (AIHigh != 0) {
-            AIHigh = 0;
-        } else {
-            AIHigh = -1; // break the loop once all cards have been checked
-        }
-    }
-    if (userThree > AIThree) { // if user's set of three is higher than AI's, user wins
-        cout << "You win!" << endl;
-        return 1;
-    } else if (userThree < AIThree) { // if user's set of three is lower than AI's, AI wins
-        cout << "Daniel wins!" << endl;
-        return 2;
-    } else { // if the sets of three are the same, check the sets of two
-        if (userTwo > AITwo) { // if user's set of two is higher than AI's, user wins
-            cout << "You win!" << endl;
-            return 1;
-        } else if (userTwo < AITwo) { // if user's set of two is lower than AI's, AI wins
-            cout << "Daniel wins!" << endl;
-            return 2;
-        } else { // if both sets of three and sets of two are the same (same full house), true tie
-            cout << "Tie!" << endl;
-            return 0;
-        }
+        cout << "High card." << endl;
     }
-    return 0;
 }
 
-// Function for resolving a tie between two flushes
-// Returns 1 if user wins, 2 if AI wins, and 0 if it is a true tie
-int GameManager::resolveTieFlush(Card* userCards, Card* AICards) {
-    int numHearts = 0, numDiamonds = 0, numSpades = 0, numClubs = 0;
-    char flushSuit = 'x';
-    for (int i = 0; i < 7; i++) { // count number of each suit and find flush suit
-        if (userCards[i].suit == 'H') {
-            numHearts += 1;
-            if (numHearts >= 5) {
-                flushSuit = 'H';
-            }
-        } else if (userCards[i].suit == 'D') {
-            numDiamonds += 1;
-            if (numDiamonds >= 5) {
-                flushSuit = 'D';
-            }
-        } else if (userCards[i].suit == 'S') {
-            numSpades += 1;
-            if (numSpades >= 5) {
-                flushSuit = 'S';
-            }
-        } else {
-            numClubs += 1;
-            if (numClubs >= 5) {
-                flushSuit = 'C';
-            }
-        }
-    }
-    int numCard = 1, userHigh = 0, AIHigh = 0, prevUserHigh = 15, prevAIHigh = 15;
-    while (numCard < 6) { // now compare user's and AI's highest 5 cards that match the flush suit
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh) && (userCards[i].suit == flushSuit)) {
-                userHigh = userCards[i].value; // find highest user card
-            }
-            if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh) && (AICards[i].suit == flushSuit)) {
-                AIHigh = AICards[i].value; // find highest AI card
-            }
-        }
-        if (userHigh > AIHigh) {
-            cout << "You win!" << endl;
-            return 1;
-        } else if (userHigh < AIHigh) {
-            cout << "Daniel wins!" << endl;
-            return 2;
-        } else {
-            numCard += 1;
-            prevUserHigh = userHigh;
-            prevAIHigh = AIHigh;
-            userHigh = 0;
-            AIHigh = 0;
-        }
-    }
-    cout << "Tie!" << endl; // if the user's and AI's top 5 cards in flush suit are the same, it's a tie
-    return 0;
-}
 
-// Function for resolving a tie between two straights
-// Returns 1 if user wins, 2 if AI wins, and 0 if it is a true tie
-int GameManager::resolveTieStraight(Card* userCards, Card* AICards) {
-    int userStraight = 0, AIStraight = 0, userHigh = 0, AIHigh = 0, prevUserHigh = 15, prevAIHigh = 15, userHighIndex = -1, AIHighIndex = -1;
-    while (userHigh != -1) { // FIND USER STRAIGHT
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh)) {
-                userHigh = userCards[i].value; // find highest value in cards less than previous highest
-                userHighIndex = i;
-            }
-        }
-        if (userHigh >= 5) { // the lowest straight has a high card of 5
-            for (int i = 0; i < 7; i++) {
-                if (userCards[i].value == userHigh - 1) { // if second high card in straight exists
-                    for (int j = 0; j < 7; j++) {
-                        if (userCards[j].value == userHigh - 2) { // if third high card in straight exists
-                            for (int k = 0; k < 7; k++) {
-                                if (userCards[k].value == userHigh - 3) { // if fourth high card in straight exists
-                                    for (int l = 0; l < 7; l++) {
-                                        if (userCards[l].value == userHigh - 4) { // if fifth high card in straight exists
-                                            userStraight = userHigh;
-                                            userHigh = 0; // need to break the loop so we don't lower the straight if 6 card straight exists
-                                        } else if ((userHigh == 5) && (userCards[l].value == 14)) { // if low card is ace
-                                            userStraight = userHigh;
-                                            userHigh = 0;
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        prevUserHigh = userHigh;
-        userHighIndex = -1; // otherwise, reset variables and try again
-        if (userHigh != 0) {
-            userHigh = 0;
-        } else { // break while loop if no new high card found (will never happen as straight is guaranteed)
-            userHigh = -1;
-        }
-    }
-    while (AIHigh != -1) { // FIND AI STRAIGHT
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh)) {
-                AIHigh = AICards[i].value; // find highest value in cards less than previous highest
-                AIHighIndex = i;
-            }
-        }
-        if (AIHigh >= 5) { // the lowest straight has a high card of 5
-            for (int i = 0; i < 7; i++) {
-                if (AICards[i].value == AIHigh - 1) { // if second high card in straight exists
-                    for (int j = 0; j < 7; j++) {
-                        if (AICards[j].value == AIHigh - 2) { // if third high card in straight exists
-                            for (int k = 0; k < 7; k++) {
-                                if (AICards[k].value == AIHigh - 3) { // if fourth high card in straight exists
-                                    for (int l = 0; l < 7; l++) {
-                                        if (AICards[l].value == AIHigh - 4) { // if fifth high card in straight exists
-                                            AIStraight = AIHigh;
-                                            AIHigh = 0; // need to break the loop so we don't lower the straight if 6 card straight exists
-                                        } else if ((userHigh == 5) && (AICards[l].value == 14)) { // if low card is ace
-                                            AIStraight = AIHigh;
-                                            AIHigh = 0;
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        prevAIHigh = AIHigh;
-        AIHighIndex = -1; // otherwise, reset variables and try again
-        if (AIHigh != 0) {
-            AIHigh = 0;
-        } else { // break while loop if no new high card found (will never happen as straight is guaranteed)
-            AIHigh = -1;
-        }
-    }
-    if (userStraight > AIStraight) {
+// Function for announcing the winner of a showdown (as returned by findShowdownWinner)
+void GameManager::describeShowdownWinner(int handWinner) {
+    if (handWinner == 1) {
         cout << "You win!" << endl;
-        return 1;
-    } else if (userStraight < AIStraight) {
+    } else if (handWinner == 2) {
         cout << "Daniel wins!" << endl;
-        return 2;
     } else {
         cout << "Tie!" << endl;
-        return 0;
     }
-    return 0;
 }
 
 
-// Function for resolving a tie between two three of a kinds
-// Returns 1 if user wins, 2 if AI wins, and 0 if it is a true tie
-int GameManager::resolveTieThreeOfAKind(Card* userCards, Card* AICards) {
-    int userSet = 0, userHigh = 0, AISet = 0, AIHigh = 0, prevUserHigh = 15, prevAIHigh = 15, userHighIndex = -1, AIHighIndex = -1;
-    while (userHigh != -1) { // FIND USER SET
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh)) {
-                userHigh = userCards[i].value; // find highest value in cards less than previous highest
-                userHighIndex = i;
-            }
-        }
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value == userHigh) && (i != userHighIndex)) {
-                userSet = userHigh; // remember the set, if found (only need to check for one match since we know hand has 3oaK, not FH
-            }
-        }
-        prevUserHigh = userHigh;
-        userHighIndex = -1;
-        if (userHigh != 0) {
-            userHigh = 0;
-        } else {
-            userHigh = -1; // break the loop if no high card was found (although this won't ever happen because pair is guaranteed)
-        }
-    }
-    while (AIHigh != -1) { // FIND AI SET
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh)) {
-                AIHigh = AICards[i].value; // find highest value in cards less than previous highest
-                AIHighIndex = i;
-            }
-        }
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value == AIHigh) && (i != AIHighIndex)) {
-                AISet = AIHigh; // // remember the set, if found (only need to check for one match since we know hand has 3oaK, not FH
-            }
-        }
-        prevAIHigh = AIHigh;
-        AIHighIndex = -1;
-        if (AIHigh != 0) {
-            AIHigh = 0;
-        } else {
-            AIHigh = -1; // break the loop if no high card was found (although this won't ever happen because set is guaranteed)
-        }
-    }
-    if (userSet > AISet) { // if user's set is higher than AI's set
-        cout << "You win!" << endl;
-        return 1;
-    } else if (userSet < AISet) { // if AI's set is higher than user's set
-        cout << "Daniel wins!" << endl;
-        return 2;
-    } else { // if the set is the same, we have to check the two kickers (only occurs with 2/3 on board, other 2 in hands)
-        prevUserHigh = 15;
-        prevAIHigh = 15;
-        userHigh = 0;
-        AIHigh = 0; // reset searching variables
-        userHighIndex = -1;
-        AIHighIndex = -1;
-        int numCard = 1;
-        while (numCard < 3) {
-            for (int i = 0; i < 7; i++) {
-                if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh) && (userCards[i].value != userSet)) {
-                    userHigh = userCards[i].value; // find highest user card, excluding the paired cards
-                }
-                if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh) && (AICards[i].value != AISet)) {
-                    AIHigh = AICards[i].value; // find highest AI card, excluding the paired cards
-                }
-            }
-            if (userHigh > AIHigh) {
-                cout << "You win!" << endl;
-                return 1;
-            } else if (userHigh < AIHigh) {
-                cout << "Daniel wins!" << endl;
-                return 2;
-            } else {
-                numCard += 1;
-                prevUserHigh = userHigh;
-                prevAIHigh = AIHigh;
-                userHigh = 0;
-                AIHigh = 0;
-            }
-        }
-    }
-    cout << "Tie!" << endl; // if each of the user's and AI's set and next highest 2 cards are the same, the hand is a tie
-    return 0;
-}
-
-
-// Function for resolving a tie between two two pairs
-// Returns 1 if user wins, 2 if AI wins, and 0 if it is a true tie
-int GameManager::resolveTieTwoPair(Card* userCards, Card* AICards) {
-    int userFirstPair = 0, userSecondPair = 0, userHigh = 0, AIFirstPair = 0, AISecondPair = 0, AIHigh = 0, prevUserHigh = 15, prevAIHigh = 15, userHighIndex = -1, AIHighIndex = -1;
-    while (userHigh != -1) { // FIND USER'S HIGH PAIR
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh)) {
-                userHigh = userCards[i].value; // find highest value in cards less than previous highest
-                userHighIndex = i;
-            }
-        }
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value == userHigh) && (i != userHighIndex) && (userFirstPair == 0)) {
-                userFirstPair = userHigh; // remember the pair, if found
-            }
-        }
-        prevUserHigh = userHigh;
-        userHighIndex = -1;
-        if (userHigh != 0) {
-            userHigh = 0;
-        } else {
-            userHigh = -1; // break the loop if no high card was found (although this won't ever happen because pair is guaranteed)
-        }
-    }
-    while (AIHigh != -1) { // FIND AI'S HIGH PAIR
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh)) {
-                AIHigh = AICards[i].value; // find highest value in cards less than previous highest
-                AIHighIndex = i;
-            }
-        }
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value == AIHigh) && (i != AIHighIndex) && (AIFirstPair == 0)) {
-                AIFirstPair = AIHigh; // remember the pair, if found
-            }
-        }
-        prevAIHigh = AIHigh;
-        AIHighIndex = -1;
-        if (AIHigh != 0) {
-            AIHigh = 0;
-        } else {
-            AIHigh = -1; // break the loop if no high card was found (although this won't ever happen because pair is guaranteed)
-        }
-    }
-    if (userFirstPair > AIFirstPair) { // if user's high pair is higher than AI's pair
-        cout << "You win!" << endl;
-        return 1;
-    } else if (userFirstPair < AIFirstPair) { // if AI's high pair is higher than user's pair
-        cout << "Daniel wins!" << endl;
-        return 2;
-    } else { // if high pairs are the same, we have to check the low pair
-        prevUserHigh = 15;
-        prevAIHigh = 15;
-        userHigh = 0;
-        AIHigh = 0; // reset searching variables
-        userHighIndex = -1;
-        AIHighIndex = -1;
-        while (userHigh != -1) { // FIND USER'S LOW HIGH PAIR
-            for (int i = 0; i < 7; i++) {
-                if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh) && (userCards[i].value != userFirstPair)) {
-                    userHigh = userCards[i].value; // find highest value in cards less than previous highest
-                    userHighIndex = i;
-                }
-            }
-            for (int i = 0; i < 7; i++) {
-                if ((userCards[i].value == userHigh) && (i != userHighIndex) && (userSecondPair == 0)) {
-                    userSecondPair = userHigh; // remember the pair, if found
-                }
-            }
-            prevUserHigh = userHigh;
-            userHighIndex = -1;
-            if (userHigh != 0) {
-                userHigh = 0;
-            } else {
-                userHigh = -1; // break the loop if no high card was found (although this won't ever happen because pair is guaranteed)
-            }
-        }
-        while (AIHigh != -1) { // FIND AI'S LOW HIGH PAIR
-            for (int i = 0; i < 7; i++) {
-                if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh) && (AICards[i].value != AIFirstPair)) {
-                    AIHigh = AICards[i].value; // find highest value in cards less than previous highest
-                    AIHighIndex = i;
-                }
-            }
-            for (int i = 0; i < 7; i++) {
-                if ((AICards[i].value == AIHigh) && (i != AIHighIndex) && (AISecondPair == 0)) {
-                    AISecondPair = AIHigh; // remember the pair, if found
-                }
-            }
-            prevAIHigh = AIHigh;
-            AIHighIndex = -1;
-            if (AIHigh != 0) {
-                AIHigh = 0;
-            } else {
-                AIHigh = -1; // break the loop if no high card was found (although this won't ever happen because pair is guaranteed)
-            }
-        }
-        if (userSecondPair > AISecondPair) { // if user's high pair is higher than AI's pair
-            cout << "You win!" << endl;
-            return 1;
-        } else if (userSecondPair < AISecondPair) { // if AI's high pair is higher than user's pair
-            cout << "Daniel wins!" << endl;
-            return 2;
-        } else { // if BOTH pairs have now proven to be the same, we check the 5th card kicker
-            userHigh = 0;
-            AIHigh = 0; // reset searching variables
-            userHighIndex = -1;
-            AIHighIndex = -1;
-            for (int i = 0; i < 7; i++) {
-                if ((userCards[i].value > userHigh) && (userCards[i].value != userFirstPair) && (userCards[i].value != userSecondPair)) {
-                    userHigh = userCards[i].value; // find highest user card, excluding the two pairs
-                }
-                if ((AICards[i].value > AIHigh) && (AICards[i].value != AIFirstPair) && (AICards[i].value != AISecondPair)) {
-                    AIHigh = AICards[i].value; // find highest AI card, excluding the two pairs
-                }
-            }
-            if (userHigh > AIHigh) {
-                cout << "You win!" << endl;
-                return 1;
-            } else if (userHigh < AIHigh) {
-                cout << "Daniel wins!" << endl;
-                return 2;
-            } else {
-                cout << "Tie!" << endl;
-                return 0; // if user's and AI's two pairs and 5th card are all the same, it's a tie
-            }
-        }
-    }
-    return 0; // I don't think the function will ever get here
-}
 
 
 
-// Function for resolving a tie between two pairs
-// Returns 1 if user wins, 2 if AI wins, and 0 if it is a true tie
-int GameManager::resolveTiePair(Card* userCards, Card* AICards) {
-    int userPair = 0, userHigh = 0, AIPair = 0, AIHigh = 0, prevUserHigh = 15, prevAIHigh = 15, userHighIndex = -1, AIHighIndex = -1;
-    while (userHigh != -1) { // FIND USER PAIR
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh)) {
-                userHigh = userCards[i].value; // find highest value in cards less than previous highest
-                userHighIndex = i;
-            }
-        }
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value == userHigh) && (i != userHighIndex)) {
-                userPair = userHigh; // remember the pair, if found
-            }
-        }
-        prevUserHigh = userHigh;
-        userHighIndex = -1;
-        if (userHigh != 0) {
-            userHigh = 0;
-        } else {
-            userHigh = -1; // break the loop if no high card was found (although this won't ever happen because pair is guaranteed)
-        }
-    }
-    while (AIHigh != -1) { // FIND AI PAIR
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh)) {
-                AIHigh = AICards[i].value; // find highest value in cards less than previous highest
-                AIHighIndex = i;
-            }
-        }
-        for (int i = 0; i < 7; i++) {
-            if ((AICards[i].value == AIHigh) && (i != AIHighIndex)) {
-                AIPair = AIHigh; // remember the pair, if found
-            }
-        }
-        prevAIHigh = AIHigh;
-        AIHighIndex = -1;
-        if (AIHigh != 0) {
-            AIHigh = 0;
-        } else {
-            AIHigh = -1; // break the loop if no high card was found (although this won't ever happen because pair is guaranteed)
-        }
-    }
-    if (userPair > AIPair) { // if user's pair is higher than AI's pair
-        cout << "You win!" << endl;
-        return 1;
-    } else if (userPair < AIPair) { // if AI's pair is higher than user's pair
-        cout << "Daniel wins!" << endl;
-        return 2;
-    } else { // if pairs are the same, we have to check the three kickers
-        prevUserHigh = 15;
-        prevAIHigh = 15;
-        userHigh = 0;
-        AIHigh = 0; // reset searching variables
-        userHighIndex = -1;
-        AIHighIndex = -1;
-        int numCard = 1;
-        while (numCard < 4) {
-            for (int i = 0; i < 7; i++) {
-                if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh) && (userCards[i].value != userPair)) {
-                    userHigh = userCards[i].value; // find highest user card, excluding the paired cards
-                }
-                if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh) && (AICards[i].value != AIPair)) {
-                    AIHigh = AICards[i].value; // find highest AI card, excluding the paired cards
-                }
-            }
-            if (userHigh > AIHigh) {
-                cout << "You win!" << endl;
-                return 1;
-            } else if (userHigh < AIHigh) {
-                cout << "Daniel wins!" << endl;
-                return 2;
-            } else {
-                numCard += 1;
-                prevUserHigh = userHigh;
-                prevAIHigh = AIHigh;
-                userHigh = 0;
-                AIHigh = 0;
-            }
-        }
-    }
-    cout << "Tie!" << endl; // if each of the user's and AI's pairs and next highest 3 cards are the same, the hand is a tie
-    return 0;
-}
 
-// Function for resolving a tie between two high cards
-// Returns 1 if user wins, 2 if AI wins, and 0 if it is a true tie
-int GameManager::resolveTieHighCard(Card* userCards, Card* AICards) {
-    int numCard = 1, userHigh = 0, AIHigh = 0, prevUserHigh = 15, prevAIHigh = 15;
-    while (numCard < 6) {
-        for (int i = 0; i < 7; i++) {
-            if ((userCards[i].value > userHigh) && (userCards[i].value < prevUserHigh)) {
-                userHigh = userCards[i].value; // find highest user card
-            }
-            if ((AICards[i].value > AIHigh) && (AICards[i].value < prevAIHigh)) {
-                AIHigh = AICards[i].value; // find highest AI card
-            }
-        }
-        if (userHigh > AIHigh) {
-            cout << "You win!" << endl;
-            return 1;
-        } else if (userHigh < AIHigh) {
-            cout << "Daniel wins!" << endl;
-            return 2;
-        } else {
-            numCard += 1;
-            prevUserHigh = userHigh;
-            prevAIHigh = AIHigh;
-            userHigh = 0;
-            AIHigh = 0;
-        }
-    }
-    cout << "Tie!" << endl; // if each of the user's and AI's top 5 cards are the same, the hand is a tie
-    return 0;
-}
 
 
 // Function for initializing the deck
-// Creates a deck of 53 Card objects, consisting of the 52 cards in a real card deck,
+// Creates a deck of 53 Card objects, consisting of the 52 cards in a real card deck (deck[i] is the card with id i),
 // and then a 53rd "dead" card that is used for some of the GameManager logic
 void GameManager::initDeck() {
     potSize = 0;
     userStack = 200;
     AIStack = 200;
-    (deck+0)->value = 14;
-    (deck+0)->suit = 'H';
-    (deck+1)->value = 14;
-    (deck+1)->suit = 'D';
-    (deck+2)->value = 14;
-    (deck+2)->suit = 'S';
-    (deck+3)->value = 14;
-    (deck+3)->suit = 'C';
-    (deck+4)->value = 2;
-    (deck+4)->suit = 'H';
-    (deck+5)->value = 2;
-    (deck+5)->suit = 'D';
-    (deck+6)->value = 2;
-    (deck+6)->suit = 'S';
-    (deck+7)->value = 2;
-    (deck+7)->suit = 'C';
-    (deck+8)->value = 3;
-    (deck+8)->suit = 'H';
-    (deck+9)->value = 3;
-    (deck+9)->suit = 'D';
-    (deck+10)->value = 3;
-    (deck+10)->suit = 'S';
-    (deck+11)->value = 3;
-    (deck+11)->suit = 'C';
-    (deck+12)->value = 4;
-    (deck+12)->suit = 'H';
-    (deck+13)->value = 4;
-    (deck+13)->suit = 'D';
-    (deck+14)->value = 4;
-    (deck+14)->suit = 'S';
-    (deck+15)->value = 4;
-    (deck+15)->suit = 'C';
-    (deck+16)->value = 5;
-    (deck+16)->suit = 'H';
-    (deck+17)->value = 5;
-    (deck+17)->suit = 'D';
-    (deck+18)->value = 5;
-    (deck+18)->suit = 'S';
-    (deck+19)->value = 5;
-    (deck+19)->suit = 'C';
-    (deck+20)->value = 6;
-    (deck+20)->suit = 'H';
-    (deck+21)->value = 6;
-    (deck+21)->suit = 'D';
-    (deck+22)->value = 6;
-    (deck+22)->suit = 'S';
-    (deck+23)->value = 6;
-    (deck+23)->suit = 'C';
-    (deck+24)->value = 7;
-    (deck+24)->suit = 'H';
-    (deck+25)->value = 7;
-    (deck+25)->suit = 'D';
-    (deck+26)->value = 7;
-    (deck+26)->suit = 'S';
-    (deck+27)->value = 7;
-    (deck+27)->suit = 'C';
-    (deck+28)->value = 8;
-    (deck+28)->suit = 'H';
-    (deck+29)->value = 8;
-    (deck+29)->suit = 'D';
-    (deck+30)->value = 8;
-    (deck+30)->suit = 'S';
-    (deck+31)->value = 8;
-    (deck+31)->suit = 'C';
-    (deck+32)->value = 9;
-    (deck+32)->suit = 'H';
-    (deck+33)->value = 9;
-    (deck+33)->suit = 'D';
-    (deck+34)->value = 9;
-    (deck+34)->suit = 'S';
-    (deck+35)->value = 9;
-    (deck+35)->suit = 'C';
-    (deck+36)->value = 10;
-    (deck+36)->suit = 'H';
-    (deck+37)->value = 10;
-    (deck+37)->suit = 'D';
-    (deck+38)->value = 10;
-    (deck+38)->suit = 'S';
-    (deck+39)->value = 10;
-    (deck+39)->suit = 'C';
-    (deck+40)->value = 11;
-    (deck+40)->suit = 'H';
-    (deck+41)->value = 11;
-    (deck+41)->suit = 'D';
-    (deck+42)->value = 11;
-    (deck+42)->suit = 'S';
-    (deck+43)->value = 11;
-    (deck+43)->suit = 'C';
-    (deck+44)->value = 12;
-    (deck+44)->suit = 'H';
-    (deck+45)->value = 12;
-    (deck+45)->suit = 'D';
-    (deck+46)->value = 12;
-    (deck+46)->suit = 'S';
-    (deck+47)->value = 12;
-    (deck+47)->suit = 'C';
-    (deck+48)->value = 13;
-    (deck+48)->suit = 'H';
-    (deck+49)->value = 13;
-    (deck+49)->suit = 'D';
-    (deck+50)->value = 13;
-    (deck+50)->suit = 'S';
-    (deck+51)->value = 13;
-    (deck+51)->suit = 'C';
+    for (int i = 0; i < 52; i++) { // the deck is laid out in card id order (see Card.cpp)
+        deck[i] = Card::fromId(i);
+        deckOrder[i] = i;
+    }
     (deck+52)->value = -1;
     (deck+52)->suit = 'X';
 }
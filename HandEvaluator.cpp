@@ -0,0 +1,185 @@
+//
+//  HandEvaluator.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+
+// ------  HAND EVALUATOR ------
+
+// The hand evaluator maps any set of 5, 6, or 7 cards to a single int, the hand's "rank".
+// Ranks are totally ordered: a higher rank always beats a lower rank, and two hands with
+// the same rank are a true tie.  This means a showdown is just one integer comparison.
+//
+// The rank is laid out as follows (most significant bits first):
+//  bits 20-23: the hand category (same values as the hand finders used)
+//      8 - Straight flush
+//      7 - Four of a kind
+//      6 - Full house
+//      5 - Flush
+//      4 - Straight
+//      3 - Three of a kind
+//      2 - Two pair
+//      1 - Pair
+//      0 - High card
+//  bits 0-19: five 4 bit card values (2 - 14), in the order they matter for breaking ties
+//      e.g. two pair, kings and fives with an ace kicker is 13, 5, 14, 0, 0
+// Every rank fits in 24 bits, so it can also be stored exactly in a float.
+
+// Builds a rank out of a category and up to five tie breaking card values
+int makeHandRank(int category, int first, int second, int third, int fourth, int fifth) {
+    return (category << 20) | (first << 16) | (second << 12) | (third << 8) | (fourth << 4) | fifth;
+}
+
+// Returns the category (0 - 8) of a rank built by evaluateHand
+int handCategory(int handRank) {
+    return handRank >> 20;
+}
+
+// Finds the highest straight within a bitmask of card values (bit 0 is a two, bit 12 is an ace)
+// Returns the value of the straight's high card, or 0 if there is no straight
+int findStraightHigh(int valueMask) {
+    // shift the mask up one, and copy the ace into bit 0 so that it can also play as a one (ace-5 straight)
+    int extended = (valueMask << 1) | ((valueMask >> 12) & 1);
+    int runs = extended & (extended >> 1) & (extended >> 2) & (extended >> 3) & (extended >> 4);
+    if (runs == 0) {
+        return 0;
+    }
+    // bit k of runs means the card values k+1 through k+5 are all present
+    return (31 - __builtin_clz(runs)) + 5;
+}
+
+// Collects the highest n card values from a bitmask of card values into the values array
+// Returns how many values were collected
+int topValues(int valueMask, int n, int* values) {
+    int found = 0;
+    for (int v = 14; (v >= 2) && (found < n); v--) {
+        if (valueMask & (1 << (v - 2))) {
+            values[found] = v;
+            found += 1;
+        }
+    }
+    return found;
+}
+
+// Function for evaluating a set of 5, 6, or 7 cards
+// Works straight off of the set's per suit bitmasks: the masks are added together bit by bit
+// to find which values appear once, twice, three or four times, and the best five card hand
+// is then read off of those masks
+// Returns the rank of the best hand (see above for the layout)
+int evaluateHand(CardSet cards) {
+    int suitMasks[4] = {cards.suitMask(0), cards.suitMask(1), cards.suitMask(2), cards.suitMask(3)};
+    int kickers[5] = {0, 0, 0, 0, 0};
+
+    // with 7 or fewer cards, a flush can't coexist with four of a kind or a full house,
+    // so flushes (and straight flushes) can be checked first
+    for (int s = 0; s < 4; s++) {
+        if (__builtin_popcount(suitMasks[s]) >= 5) {
+            int straightFlushHigh = findStraightHigh(suitMasks[s]);
+            if (straightFlushHigh != 0) {
+                return makeHandRank(8, straightFlushHigh, 0, 0, 0, 0);
+            }
+            topValues(suitMasks[s], 5, kickers);
+            return makeHandRank(5, kickers[0], kickers[1], kickers[2], kickers[3], kickers[4]);
+        }
+    }
+
+    // count how many times each value appears, as a 3 bit number spread over three masks
+    int ones = 0, twos = 0, fours = 0;
+    for (int s = 0; s < 4; s++) {
+        int carry = ones & suitMasks[s];
+        ones ^= suitMasks[s];
+        fours |= twos & carry;
+        twos ^= carry;
+    }
+    int valueMask = ones | twos | fours;
+    int fourMask = fours;
+    int threeMask = ones & twos;
+    int pairMask = twos & ~ones;
+
+    if (fourMask != 0) {
+        int four = 31 - __builtin_clz(fourMask) + 2;
+        topValues(valueMask & ~fourMask, 1, kickers);
+        return makeHandRank(7, four, kickers[0], 0, 0, 0);
+    }
+    if (threeMask != 0) {
+        int three = 31 - __builtin_clz(threeMask) + 2;
+        // the pair of a full house can come from a second three of a kind
+        int otherPairs = (threeMask & ~(1 << (three - 2))) | pairMask;
+        if (otherPairs != 0) {
+            return makeHandRank(6, three, 31 - __builtin_clz(otherPairs) + 2, 0, 0, 0);
+        }
+    }
+    int straightHigh = findStraightHigh(valueMask);
+    if (straightHigh != 0) {
+        return makeHandRank(4, straightHigh, 0, 0, 0, 0);
+    }
+    if (threeMask != 0) {
+        int three = 31 - __builtin_clz(threeMask) + 2;
+        topValues(valueMask & ~threeMask, 2, kickers);
+        return makeHandRank(3, three, kickers[0], kickers[1], 0, 0);
+    }
+    if (__builtin_popcount(pairMask) >= 2) {
+        int pairs[2];
+        topValues(pairMask, 2, pairs);
+        // a third pair can still play as the kicker
+        topValues(valueMask & ~(1 << (pairs[0] - 2)) & ~(1 << (pairs[1] - 2)), 1, kickers);
+        return makeHandRank(2, pairs[0], pairs[1], kickers[0], 0, 0);
+    }
+    if (pairMask != 0) {
+        int pair = 31 - __builtin_clz(pairMask) + 2;
+        topValues(valueMask & ~pairMask, 3, kickers);
+        return makeHandRank(1, pair, kickers[0], kickers[1], kickers[2], 0);
+    }
+    topValues(valueMask, 5, kickers);
+    return makeHandRank(0, kickers[0], kickers[1], kickers[2], kickers[3], kickers[4]);
+}
+
+// Function for evaluating an array of 5, 6, or 7 cards
+int evaluateHand(Card* cards, int numCards) {
+    return evaluateHand(CardSet::fromCards(cards, numCards));
+}
+
+
+// Structured result of evaluating a hand, for when more than the rank itself is needed
+// (e.g. describing the hand to the user).  Evaluating a hand never prints anything.
+struct HandResult {
+    int rank; // the full rank, as returned by evaluateHand
+    int category; // 0 - 8, see above
+    int values[5]; // the tie breaking card values, most important first (0 where unused)
+    char flushSuit; // the suit of a flush or straight flush, 'X' otherwise
+};
+
+// Function for evaluating a set of cards into a HandResult
+HandResult analyzeHand(Card* cards, int numCards) {
+    HandResult result;
+    result.rank = evaluateHand(cards, numCards);
+    result.category = handCategory(result.rank);
+    for (int i = 0; i < 5; i++) {
+        result.values[i] = (result.rank >> (16 - 4*i)) & 0xF;
+    }
+    result.flushSuit = 'X';
+    if ((result.category == 8) || (result.category == 5)) {
+        CardSet set = CardSet::fromCards(cards, numCards);
+        const char suits[4] = {'H', 'D', 'S', 'C'};
+        for (int s = 0; s < 4; s++) {
+            if (__builtin_popcount(set.suitMask(s)) >= 5) {
+                result.flushSuit = suits[s];
+            }
+        }
+    }
+    return result;
+}
+
+// Function for deciding a showdown between the user's and the AI's hand ranks
+// Returns 1 if the user wins, 2 if the AI wins, and 0 if it is a tie (the same values finishHand expects)
+int findShowdownWinner(int userHandRank, int AIHandRank) {
+    if (userHandRank > AIHandRank) {
+        return 1;
+    } else if (userHandRank < AIHandRank) {
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,113 @@
+//
+//  Player.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+using namespace std;
+
+
+// Player class
+// Anything that can take a seat at the table: the AI, a scripted player, a random player, etc.
+// Whenever it's a seat's turn to bet, GameManager asks that seat's Player for its bet.
+// (A seat without a Player is played by the user from the console.)
+class Player {
+public:
+    bool verbose = true; // if false, the player never writes to the console (or sleeps)
+    virtual ~Player() {}
+    // Decide on a bet.  The parameters are everything relevant on the poker table, from this player's point of view:
+    //  the current bet, the last bet this player made, the pot size, this player's stack, the opponent's stack,
+    //  this player's cards, the cards on the board (undealt cards are "dead"), the round of betting, the deck, and
+    //  whether the opponent has already acted in this round of betting (so checking behind the opponent's check ends it)
+    // Returns -1 to fold, 0 to check, and otherwise the amount the player puts in (a call or a raise)
+    virtual int makeBetDecision(int currBet, int lastBet, int potSize, int stack, int opponentStack, Card* hand, Card* boardCards, int betRound, Card* deck, bool opponentActed) = 0;
+    // Called when a hand ends, so the player can reset anything it tracked during the hand
+    virtual void resetHand() {}
+    // Called when a game is seeded (see GameManager::seedRng), so a player that makes random choices can take its own
+    // streams from source, and a seeded game always plays out the same way
+    virtual void seed(Rng& source) {}
+    // Called when the opponent starts deciding on a bet, so the player can get ahead on its own work in the meantime
+    // (hand, boardCards, and betRound as for makeBetDecision).  stopThinkingAhead is called as soon as the opponent bets.
+    virtual void startThinkingAhead(Card* hand, Card* boardCards, int betRound) {}
+    virtual void stopThinkingAhead() {}
+};
+
+
+// ScriptedPlayer class
+// Plays a fixed script of actions, in order, starting over when the script runs out.  Useful for testing the AI
+// against predictable opponents, e.g. a script of just {0} is a "calling station" that always checks or calls.
+//  -1: fold (or check, if there's nothing to call)
+//   0: check, or call the current bet
+//  n > 0: raise by n on top of calling (or bet n, if there's nothing to call)
+class ScriptedPlayer : public Player {
+public:
+    int script[16];
+    int scriptLength;
+    int nextAction;
+    // Overload constructor, copies the script (up to 16 actions)
+    ScriptedPlayer(const int* actions, int numActions) {
+        scriptLength = 0;
+        for (int i = 0; (i < numActions) && (i < 16); i++) {
+            script[i] = actions[i];
+            scriptLength += 1;
+        }
+        nextAction = 0;
+        verbose = false;
+    }
+    // Starts the script over, so every seeded game plays it from the start
+    void seed(Rng& source) {
+        nextAction = 0;
+    }
+    int makeBetDecision(int currBet, int lastBet, int potSize, int stack, int opponentStack, Card* hand, Card* boardCards, int betRound, Card* deck, bool opponentActed) {
+        int action = 0;
+        if (scriptLength > 0) {
+            action = script[nextAction];
+            nextAction = (nextAction + 1) % scriptLength;
+        }
+        int amountOwed = currBet - lastBet;
+        if (action < 0) {
+            return (amountOwed > 0) ? -1 : 0;
+        }
+        int bet = amountOwed + action;
+        if (bet > stack) {
+            bet = stack;
+        }
+        return bet;
+    }
+};
+
+
+// RandomPlayer class
+// Picks a random legal action every time: folds 10% of the time when facing a bet, raises 25% of the time,
+// and otherwise checks or calls.  Raises are a random size between the minimum raise and the pot.
+class RandomPlayer : public Player {
+public:
+    Rng rng;
+    // Overload constructor, seeds the player's own random number generator
+    RandomPlayer(uint64_t seed) {
+        rng.seed(seed);
+        verbose = false;
+    }
+    void seed(Rng& source) {
+        rng = source.forkStream();
+    }
+    int makeBetDecision(int currBet, int lastBet, int potSize, int stack, int opponentStack, Card* hand, Card* boardCards, int betRound, Card* deck, bool opponentActed) {
+        int amountOwed = currBet - lastBet;
+        int roll = rng.nextInt(100);
+        if ((amountOwed > 0) && (roll < 10)) {
+            return -1;
+        }
+        int bet = amountOwed;
+        if (roll >= 75) {
+            int minRaise = (currBet > 2) ? currBet : 2;
+            int maxRaise = (potSize > minRaise) ? potSize : minRaise;
+            bet += minRaise + rng.nextInt(maxRaise - minRaise + 1);
+        }
+        if (bet > stack) {
+            bet = stack;
+        }
+        return bet;
+    }
+};
@@ -0,0 +1,226 @@
+//
+//  PreflopTable.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+// ------  PRE-FLOP EQUITY TABLE ------
+
+// Before the flop only the two hole cards are known, and with no board the suits only matter for whether the two
+// cards match, so all 1326 starting hands fall into 169 classes: 13 pairs, 78 suited hands, and 78 offsuit hands.
+// The table holds the all in equity of every class against every other class, generated offline by sampling
+// ("./main --build-preflop-table <file>") and saved as a small binary file that's loaded once at startup.
+//
+// Classes are numbered like the cells of a 13x13 grid, with rows and columns going from two up to ace:
+//  pairs are on the diagonal, suited hands below it (row = high card, column = low card), and offsuit hands above it
+//  (row = low card, column = high card)
+//
+// The file is a PreflopTableHeader followed by 169 x 169 equities, each stored as a uint16 (0 - 65535 for 0 - 1),
+// in the byte order of the machine that built it.  Entry [a][b] is class a's equity against class b.
+
+// Returns the class (0 - 168) of a starting hand, given the ids of its two cards
+int preflopClass(int firstId, int secondId) {
+    int firstValue = firstId % 13, secondValue = secondId % 13;
+    int high = (firstValue > secondValue) ? firstValue : secondValue;
+    int low = (firstValue > secondValue) ? secondValue : firstValue;
+    if ((firstId / 13) == (secondId / 13)) { // suited
+        return high * 13 + low;
+    }
+    return low * 13 + high; // offsuit (or a pair, where high == low)
+}
+
+// Header at the start of a pre-flop table file
+struct PreflopTableHeader {
+    char magic[4]; // always "PFEQ"
+    uint32_t version; // always 1
+    uint32_t numClasses; // always 169
+    uint32_t samples; // how many deals each matchup was sampled with
+};
+
+
+// PreflopTable Class
+class PreflopTable {
+public:
+    bool loaded; // whether the table holds equities (from load or generate)
+    uint16_t equity[169][169]; // equity[a][b] is class a's equity against class b, scaled to 0 - 65535
+    float equityVsRandom[169]; // each class's equity against a random hand, for ranking hands against each other
+    unsigned char comboClass[1326]; // the class of each combo (indexed like the AI's range)
+    vector<int> classCombos[169]; // the combos in each class
+    // Default constructor
+    PreflopTable() {
+        loaded = false;
+        for (int x = 0; x < 1326; x++) {
+            comboClass[x] = (unsigned char)preflopClass(comboTable.cards[x][0], comboTable.cards[x][1]);
+            classCombos[comboClass[x]].push_back(x);
+        }
+    }
+    float lookup(int AIClass, int userClass);
+    float rangeEquity(int AIClass, const float* weights);
+    bool load(const char* path);
+    bool save(const char* path, int samples);
+    void generate(int samples, uint64_t seed, int numThreads);
+    void generateMatchups(int firstMatchup, int matchupStep, int samples, uint64_t seed);
+    void finishLoading();
+};
+
+
+// Function for looking up one class's equity against another
+float PreflopTable::lookup(int AIClass, int userClass) {
+    return equity[AIClass][userClass] / 65535.0f;
+}
+
+
+// Function for finding a class's equity against a range, as the weighted average of its equity against each hand
+// weights holds how likely the user is to have each hand (indexed like the AI's range, 0 for hands not in the range)
+// Returns the equity, or 0 if the range is empty
+float PreflopTable::rangeEquity(int AIClass, const float* weights) {
+    double total = 0.0, totalWeight = 0.0;
+    for (int x = 0; x < 1326; x++) {
+        if (weights[x] > 0) {
+            total += weights[x] * equity[AIClass][comboClass[x]];
+            totalWeight += weights[x];
+        }
+    }
+    if (totalWeight == 0) {
+        return 0.0;
+    }
+    return (float)(total / totalWeight / 65535.0);
+}
+
+
+// Function for loading the table from a file built by save
+// Returns whether the file was read (if not, e.g. it doesn't exist, is from a different version, or was built from no
+// samples, the table stays unloaded)
+bool PreflopTable::load(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    PreflopTableHeader header;
+    bool valid = (fread(&header, sizeof(header), 1, file) == 1) && (memcmp(header.magic, "PFEQ", 4) == 0) &&
+        (header.version == 1) && (header.numClasses == 169) && (header.samples > 0) && (fread(equity, sizeof(equity), 1, file) == 1);
+    fclose(file);
+    if (valid) {
+        finishLoading();
+    }
+    return valid;
+}
+
+
+// Function for saving the table to a file
+// Returns whether the whole file was written
+bool PreflopTable::save(const char* path, int samples) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        return false;
+    }
+    PreflopTableHeader header;
+    memcpy(header.magic, "PFEQ", 4);
+    header.version = 1;
+    header.numClasses = 169;
+    header.samples = (uint32_t)samples;
+    bool written = (fwrite(&header, sizeof(header), 1, file) == 1) && (fwrite(equity, sizeof(equity), 1, file) == 1);
+    return (fclose(file) == 0) && written;
+}
+
+
+// Function for filling in the values that follow from the equities, once they're known
+void PreflopTable::finishLoading() {
+    // against a random hand, every class is weighted by how many combos it has
+    for (int a = 0; a < 169; a++) {
+        double total = 0.0;
+        for (int b = 0; b < 169; b++) {
+            total += (double)classCombos[b].size() * equity[a][b];
+        }
+        equityVsRandom[a] = (float)(total / 1326.0 / 65535.0);
+    }
+    loaded = true;
+}
+
+
+// Function for generating the table by sampling
+// Every matchup is played out samples times: each time, concrete hands from the two classes that don't share a card
+// are picked at random (so card removal is accounted for, e.g. AK blocks some of the AQ hands), and a random board is
+// dealt from the 48 cards that are left.  Only half of the matchups are sampled, since b against a is 1 minus a against b.
+// Every matchup is sampled with its own generator, seeded from (seed + matchup number), so the table only depends on the
+// seed and the number of samples, and not on how many threads built it.
+// numThreads of 0 means one thread per core
+void PreflopTable::generate(int samples, uint64_t seed, int numThreads) {
+    if (numThreads <= 0) {
+        numThreads = (int)thread::hardware_concurrency();
+        if (numThreads <= 0) {
+            numThreads = 1;
+        }
+    }
+    vector<thread> workers;
+    for (int t = 0; t < numThreads; t++) {
+        workers.push_back(thread(&PreflopTable::generateMatchups, this, t, numThreads, samples, seed));
+    }
+    for (size_t t = 0; t < workers.size(); t++) {
+        workers[t].join();
+    }
+    finishLoading();
+}
+
+
+// Function for generating every matchupStep-th matchup (a <= b), starting from firstMatchup (run by each thread)
+// Each matchup is only written by the thread that samples it, so the threads never touch the same entries
+void PreflopTable::generateMatchups(int firstMatchup, int matchupStep, int samples, uint64_t seed) {
+    int matchup = 0;
+    for (int a = 0; a < 169; a++) {
+        for (int b = a; b < 169; b++, matchup++) {
+            if ((matchup % matchupStep) != firstMatchup) {
+                continue;
+            }
+            if (a == b) { // a class against itself is even, by symmetry
+                equity[a][b] = 32768;
+                continue;
+            }
+            Rng rng(seed + (uint64_t)matchup);
+            const vector<int>& firstCombos = classCombos[a];
+            const vector<int>& secondCombos = classCombos[b];
+            double wins = 0.0;
+            for (int s = 0; s < samples; s++) {
+                uint64_t firstMask = comboTable.masks[firstCombos[rng.nextInt((int)firstCombos.size())]];
+                uint64_t secondMask;
+                do {
+                    secondMask = comboTable.masks[secondCombos[rng.nextInt((int)secondCombos.size())]];
+                } while ((firstMask & secondMask) != 0);
+                // deal a board of five from the 48 cards left (partial Fisher-Yates)
+                int liveCards[48];
+                int numLive = 0;
+                for (int id = 0; id < 52; id++) {
+                    if (((firstMask | secondMask) >> id & 1) == 0) {
+                        liveCards[numLive] = id;
+                        numLive += 1;
+                    }
+                }
+                CardSet board;
+                for (int i = 0; i < 5; i++) {
+                    int swapWith = i + rng.nextInt(numLive - i);
+                    int id = liveCards[swapWith];
+                    liveCards[swapWith] = liveCards[i];
+                    board.add(id);
+                }
+                int firstRank = evaluateHand(CardSet(board.bits | firstMask));
+                int secondRank = evaluateHand(CardSet(board.bits | secondMask));
+                wins += (firstRank > secondRank) ? 1.0 : ((firstRank == secondRank) ? 0.5 : 0.0);
+            }
+            int scaled = (int)(wins / samples * 65535.0 + 0.5);
+            equity[a][b] = (uint16_t)scaled;
+            equity[b][a] = (uint16_t)(65535 - scaled);
+        }
+    }
+}
+
+
+PreflopTable preflopTable;
@@ -0,0 +1,564 @@
+//
+//  RiverSolver.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+// ------  RIVER SOLVER ------
+
+// On the river there are no more cards to come, so what's left of the hand is a small game: a few rounds of betting
+// followed by a showdown (or a fold).  The river solver plays that game out as a betting tree with a few bet sizes,
+// and finds a near equilibrium strategy for it with CFR+ (counterfactual regret minimization, with regrets floored
+// at 0 and iterations weighted linearly in the average strategy).
+//
+// Both players have a range: the user's is the range the AI has been tracking (see UserRange), and the AI's is every
+// hand that doesn't use a board card, all equally likely (the AI doesn't track what the user thinks it has).  Every
+// hand of both ranges gets its own strategy, and once the time budget runs out (or, without one, after maxIterations)
+// the AI plays the average strategy of the hand it actually holds.
+//
+// Payoffs come straight from the hand evaluator: each hand of both ranges is ranked once, and a showdown is worked out
+// for every hand at once by sorting the opponent's range by rank and adding up its reach with prefix sums (with the
+// hands that share a card with the hand taken back out, by keeping the same prefix sums per card).
+//
+// Each iteration updates the AI's strategies and then the user's.  An update first works out the opponent's reach at
+// every node and the prefix sums at every end of the tree (a player's reach only changes at its own decisions, so the
+// nodes under the other player's decisions share their parent's reach, and prefix sums), and then each hand's values
+// and regrets only depend on those, so the updating player's hands are split between worker threads.  The workers are
+// started once per solve and wait for each other at a barrier between the steps.  Every hand is updated the same way
+// whichever worker has it, so after a given number of iterations the strategies don't depend on the number of threads.
+
+// A node of the river betting tree
+struct RiverNode {
+    int player; // who acts: 0 for the AI, 1 for the user, -1 if the betting is over
+    int numActions;
+    int children[4];
+    int actionAmounts[4]; // the chips the player puts in with each action (-1 to fold)
+    int slot; // which of the acting player's decisions this is (indexes the regrets and strategies)
+    int AIIn; // the chips the AI has put in since the decision being solved
+    int userIn; // the chips the user has put in since the decision being solved
+    int folder; // at the end of the betting, who folded (0 the AI, 1 the user), or -1 for a showdown
+    int reachSlot[2]; // where each player's reach at this node is kept (shared with every node where it's the same)
+};
+
+
+// SolverBarrier Class
+// Makes a fixed number of threads wait until they've all reached the same point, as many times as needed
+class SolverBarrier {
+public:
+    mutex lock;
+    condition_variable released;
+    int numThreads;
+    int numWaiting;
+    int generation; // goes up every time the threads are let go, so a wait knows when it's over
+    // Overload constructor
+    SolverBarrier(int threads) {
+        numThreads = threads;
+        numWaiting = 0;
+        generation = 0;
+    }
+    // Waits until every thread has called wait
+    void wait() {
+        unique_lock<mutex> guard(lock);
+        int arrivedIn = generation;
+        numWaiting += 1;
+        if (numWaiting == numThreads) {
+            numWaiting = 0;
+            generation += 1;
+            released.notify_all();
+        } else {
+            released.wait(guard, [this, arrivedIn] { return generation != arrivedIn; });
+        }
+    }
+};
+
+
+// RiverSolver Class
+class RiverSolver {
+public:
+    int numThreads; // 0 means one thread per core
+    int maxIterations; // stop here even if there's time left (and without a deadline, always run this many)
+    int iterations; // how many iterations the last solve ran
+    vector<RiverNode> nodes; // the betting tree, every node before its children (node 0 is the decision being solved)
+    int numDecisions[2]; // how many decision nodes each player has
+    int pot; // the pot at the decision being solved
+    bool userChecked; // whether the user checked before the decision being solved (so the AI checking ends the betting)
+    // the two ranges (0 the AI's, 1 the user's)
+    int numHands[2];
+    int combos[2][1326]; // each hand's index in ComboTable
+    int ranks[2][1326]; // each hand's rank on the board
+    float initialReach[2][1326]; // how likely each hand is to start with
+    int handOf[2][1326]; // each ComboTable index's hand (-1 if it isn't in the range)
+    // how each player's range lines up against the other's sorted by rank (indexed by the player whose hand it is)
+    int sortedHands[2][1326]; // each player's hands, weakest first
+    int cardListStart[2][53]; // where each card's hands start in cardLists (weakest first, with card 52 marking the end)
+    int cardLists[2][2652];
+    int below[2][1326]; // how many of the opponent's sorted hands rank under each hand
+    int atOrBelow[2][1326]; // ... and how many rank under or tie it
+    int cardBelow[2][1326][2]; // the same within each of the hand's two cards' lists of the opponent's hands
+    int cardAtOrBelow[2][1326][2];
+    int sameHand[2][1326]; // the opponent's hand with the same two cards (-1 if there isn't one)
+    // the regrets, current strategies, and average strategies, per player, indexed [(slot * 4 + action) * hands + hand]
+    vector<float> regrets[2];
+    vector<float> strategies[2];
+    vector<float> averageStrategies[2];
+    // working space for one update
+    vector<float> opponentReach; // the opponent's reach, indexed [reach slot * opponent hands + hand]
+    vector<float> ownReach; // the updating player's reach, indexed the same way
+    vector<float> values; // the updating player's values at every node, indexed [node * hands + hand]
+    vector<double> opponentTotals; // the opponent's reach over the hands that don't block each hand, per opponent reach slot
+    vector<double> showdownShares; // ... and how much of it each hand beats (ties counting half), indexed the same way
+    vector<int> tableOffsets[2]; // where the prefix sums of each of the player's reach slots start in tables (-1 if none)
+    vector<double> tables[2]; // the prefix sums of the player's reach at the ends of the betting (when it's the opponent)
+    bool stopping; // set (by the first worker) once the solve is over
+    // Default constructor
+    RiverSolver() {
+        numThreads = 0;
+        maxIterations = 100;
+        iterations = 0;
+    }
+    int solve(CardSet board, const float* userWeights, int potSize, int amountOwed, bool checkedTo, int AIStack, int userStack, chrono::steady_clock::time_point deadline);
+    void rootStrategy(int combo, float* probabilities);
+    int addNode(int player, int AIIn, int userIn, int amountOwed, int numRaises, int AIStack, int userStack);
+    void setUpHands(CardSet board, const float* userWeights);
+    void work(int worker, int workers, SolverBarrier* barrier, chrono::steady_clock::time_point deadline);
+    void prepareUpdate(int player);
+    void updateHands(int player, int iteration, int first, int last);
+    void opponentSums(int player, int slot, int hand, double* total, double* share);
+};
+
+
+// Function for adding a node (and everything under it) to the betting tree
+// amountOwed is what the user had bet more than the AI at the decision being solved, and numRaises how many bets and
+// raises have been made (the AI can answer a bet with a raise, and there's no re-raising after that)
+// Returns the new node's index
+int RiverSolver::addNode(int player, int AIIn, int userIn, int amountOwed, int numRaises, int AIStack, int userStack) {
+    int index = (int)nodes.size();
+    nodes.push_back(RiverNode());
+    nodes[index].player = player;
+    nodes[index].numActions = 0;
+    nodes[index].AIIn = AIIn;
+    nodes[index].userIn = userIn;
+    nodes[index].folder = -1;
+    nodes[index].slot = numDecisions[player];
+    numDecisions[player] += 1;
+    int owed = (player == 0) ? (amountOwed + userIn - AIIn) : (AIIn - userIn - amountOwed);
+    int stackLeft = (player == 0) ? (AIStack - AIIn) : (userStack - userIn);
+    int opponentLeft = (player == 0) ? (userStack - userIn) : (AIStack - AIIn);
+    int actions[4];
+    int numActions = 0;
+    if (owed > 0) {
+        actions[numActions++] = -1; // fold
+    }
+    actions[numActions++] = min(owed, stackLeft); // check or call
+    if ((numRaises < 2) && (stackLeft > owed) && (opponentLeft > 0)) {
+        // bets are a share of the pot after calling: half or all of it with nothing to call, all of it to raise,
+        // and going all in (never more than the opponent can call)
+        int largest = min(stackLeft, owed + opponentLeft);
+        double sizes[2] = {0.5, 1.0};
+        for (int s = (owed > 0) ? 1 : 0; s < 2; s++) {
+            int raise = (int)(sizes[s] * (pot + AIIn + userIn + owed) + 0.5);
+            int amount = min(owed + max(raise, max(2, owed)), largest);
+            if (amount > actions[numActions - 1]) {
+                actions[numActions++] = amount;
+            }
+        }
+        if (largest > actions[numActions - 1]) {
+            actions[numActions++] = largest;
+        }
+    }
+    nodes[index].numActions = numActions;
+    for (int a = 0; a < numActions; a++) {
+        int amount = actions[a];
+        int child;
+        if (amount == -1) { // the player folds, and the betting is over
+            child = (int)nodes.size();
+            nodes.push_back(nodes[index]);
+            nodes[child].player = -1;
+            nodes[child].numActions = 0;
+            nodes[child].folder = player;
+        } else {
+            int newAIIn = AIIn + ((player == 0) ? amount : 0);
+            int newUserIn = userIn + ((player == 1) ? amount : 0);
+            // a call, or a check behind the other player's check, ends the betting (the AI's check at the root only
+            // does if the user checked before it, and otherwise the user gets to act)
+            bool bettingOver = ((amount <= owed) && ((owed > 0) || (player == 1) || ((index == 0) && userChecked)));
+            if (bettingOver) {
+                child = (int)nodes.size();
+                nodes.push_back(nodes[index]);
+                nodes[child].player = -1;
+                nodes[child].numActions = 0;
+                nodes[child].AIIn = newAIIn;
+                nodes[child].userIn = newUserIn;
+                nodes[child].folder = -1;
+            } else {
+                child = addNode(1 - player, newAIIn, newUserIn, amountOwed, numRaises + ((amount > owed) ? 1 : 0), AIStack, userStack);
+            }
+        }
+        nodes[index].children[a] = child;
+        nodes[index].actionAmounts[a] = amount;
+    }
+    return index;
+}
+
+
+// Function for setting up both ranges on the board, ranking every hand, and lining the ranges up against each other
+void RiverSolver::setUpHands(CardSet board, const float* userWeights) {
+    for (int p = 0; p < 2; p++) {
+        numHands[p] = 0;
+        for (int x = 0; x < 1326; x++) {
+            handOf[p][x] = -1;
+            if ((comboTable.masks[x] & board.bits) != 0) {
+                continue;
+            }
+            float weight = (p == 0) ? 1.0f : userWeights[x];
+            if (weight <= 0) {
+                continue;
+            }
+            int h = numHands[p];
+            combos[p][h] = x;
+            ranks[p][h] = evaluateHand(CardSet(board.bits | comboTable.masks[x]));
+            initialReach[p][h] = weight;
+            handOf[p][x] = h;
+            numHands[p] += 1;
+        }
+        for (int h = 0; h < numHands[p]; h++) {
+            sortedHands[p][h] = h;
+        }
+        const int* handRanks = ranks[p];
+        std::stable_sort(sortedHands[p], sortedHands[p] + numHands[p], [handRanks](int a, int b) { return handRanks[a] < handRanks[b]; });
+        // each card's list of hands, in the same (weakest first) order
+        int counts[53] = {0};
+        for (int h = 0; h < numHands[p]; h++) {
+            counts[comboTable.cards[combos[p][h]][0]] += 1;
+            counts[comboTable.cards[combos[p][h]][1]] += 1;
+        }
+        cardListStart[p][0] = 0;
+        for (int c = 0; c < 52; c++) {
+            cardListStart[p][c + 1] = cardListStart[p][c] + counts[c];
+            counts[c] = cardListStart[p][c];
+        }
+        for (int i = 0; i < numHands[p]; i++) {
+            int h = sortedHands[p][i];
+            for (int k = 0; k < 2; k++) {
+                int card = comboTable.cards[combos[p][h]][k];
+                cardLists[p][counts[card]] = h;
+                counts[card] += 1;
+            }
+        }
+    }
+    // where each hand's rank falls among the opponent's hands, overall and within the lists of its own two cards
+    for (int p = 0; p < 2; p++) {
+        int q = 1 - p;
+        for (int h = 0; h < numHands[p]; h++) {
+            int rank = ranks[p][h];
+            const int* qRanks = ranks[q];
+            auto lessThan = [qRanks](int hand, int r) { return qRanks[hand] < r; };
+            auto greaterThan = [qRanks](int r, int hand) { return r < qRanks[hand]; };
+            below[p][h] = (int)(std::lower_bound(sortedHands[q], sortedHands[q] + numHands[q], rank, lessThan) - sortedHands[q]);
+            atOrBelow[p][h] = (int)(std::upper_bound(sortedHands[q], sortedHands[q] + numHands[q], rank, greaterThan) - sortedHands[q]);
+            for (int k = 0; k < 2; k++) {
+                int card = comboTable.cards[combos[p][h]][k];
+                int* first = cardLists[q] + cardListStart[q][card];
+                int* last = cardLists[q] + cardListStart[q][card + 1];
+                cardBelow[p][h][k] = (int)(std::lower_bound(first, last, rank, lessThan) - first);
+                cardAtOrBelow[p][h][k] = (int)(std::upper_bound(first, last, rank, greaterThan) - first);
+            }
+            sameHand[p][h] = handOf[q][combos[p][h]];
+        }
+    }
+}
+
+
+// Function for solving the AI's decision on the river
+// userWeights is the user's range (see UserRange::weights), potSize the pot (including every bet made so far),
+// amountOwed what the AI has to put in to call, checkedTo whether the user checked to the AI (so the AI is last to
+// act, and checking behind goes to a showdown), and AIStack and userStack the chips each player has left
+// Runs CFR+ iterations until the deadline (or maxIterations), always running at least one
+// Returns how many iterations were run (0 if either range is empty, in which case there's no strategy)
+int RiverSolver::solve(CardSet board, const float* userWeights, int potSize, int amountOwed, bool checkedTo, int AIStack, int userStack, chrono::steady_clock::time_point deadline) {
+    iterations = 0;
+    nodes.clear();
+    setUpHands(board, userWeights);
+    if ((numHands[0] == 0) || (numHands[1] == 0)) {
+        return 0;
+    }
+    pot = potSize;
+    userChecked = checkedTo && (amountOwed == 0);
+    numDecisions[0] = 0;
+    numDecisions[1] = 0;
+    addNode(0, 0, 0, amountOwed, (amountOwed > 0) ? 1 : 0, AIStack, userStack);
+    int tableSize = (numHands[0] + 1) + (2 * numHands[0] + 52); // big enough for either player's range as the opponent
+    tableSize = max(tableSize, (numHands[1] + 1) + (2 * numHands[1] + 52));
+    // a player's reach only changes at its own decisions, so the other player's decisions pass theirs straight down
+    int numSlots[2] = {1, 1};
+    nodes[0].reachSlot[0] = 0;
+    nodes[0].reachSlot[1] = 0;
+    for (size_t n = 0; n < nodes.size(); n++) {
+        for (int a = 0; a < nodes[n].numActions; a++) {
+            RiverNode& child = nodes[nodes[n].children[a]];
+            for (int c = 0; c < 2; c++) {
+                child.reachSlot[c] = (nodes[n].player == c) ? numSlots[c]++ : nodes[n].reachSlot[c];
+            }
+        }
+    }
+    for (int c = 0; c < 2; c++) {
+        int numTables = 0;
+        tableOffsets[c].assign(numSlots[c], -1);
+        for (size_t n = 0; n < nodes.size(); n++) {
+            if ((nodes[n].player == -1) && (tableOffsets[c][nodes[n].reachSlot[c]] == -1)) {
+                tableOffsets[c][nodes[n].reachSlot[c]] = numTables * tableSize;
+                numTables += 1;
+            }
+        }
+        tables[c].assign((size_t)numTables * tableSize, 0.0);
+    }
+    for (int p = 0; p < 2; p++) {
+        size_t size = (size_t)numDecisions[p] * 4 * numHands[p];
+        regrets[p].assign(size, 0.0f);
+        strategies[p].assign(size, 0.0f);
+        averageStrategies[p].assign(size, 0.0f);
+    }
+    int mostHands = max(numHands[0], numHands[1]);
+    opponentReach.assign((size_t)max(numSlots[0], numSlots[1]) * mostHands, 0.0f);
+    ownReach.assign((size_t)max(numSlots[0], numSlots[1]) * mostHands, 0.0f);
+    values.assign(nodes.size() * mostHands, 0.0f);
+    opponentTotals.assign((size_t)max(numSlots[0], numSlots[1]) * mostHands, 0.0);
+    showdownShares.assign((size_t)max(numSlots[0], numSlots[1]) * mostHands, 0.0);
+    int threads = numThreads;
+    if (threads <= 0) {
+        threads = (int)thread::hardware_concurrency();
+    }
+    threads = max(1, min(threads, mostHands / 64)); // a few dozen hands each, at least, or the waiting costs more than it saves
+    stopping = false;
+    SolverBarrier barrier(threads);
+    vector<thread> workers;
+    for (int w = 1; w < threads; w++) {
+        workers.push_back(thread(&RiverSolver::work, this, w, threads, &barrier, deadline));
+    }
+    work(0, threads, &barrier, deadline);
+    for (size_t w = 0; w < workers.size(); w++) {
+        workers[w].join();
+    }
+    return iterations;
+}
+
+
+// Function run by each worker thread of solve: every iteration, for each player in turn, the first worker prepares the
+// update (see prepareUpdate) and then every worker updates its share of the player's hands
+void RiverSolver::work(int worker, int workers, SolverBarrier* barrier, chrono::steady_clock::time_point deadline) {
+    for (int t = 1; ; t++) {
+        for (int p = 0; p < 2; p++) {
+            if (worker == 0) {
+                if (p == 0) {
+                    stopping = (t > maxIterations) || ((t > 1) && (chrono::steady_clock::now() >= deadline));
+                    if (!stopping) {
+                        iterations = t;
+                    }
+                }
+                if (!stopping) {
+                    prepareUpdate(p);
+                }
+            }
+            barrier->wait();
+            if (stopping) {
+                return;
+            }
+            int first = (int)((long long)numHands[p] * worker / workers);
+            int last = (int)((long long)numHands[p] * (worker + 1) / workers);
+            updateHands(p, t, first, last);
+            barrier->wait();
+        }
+    }
+}
+
+
+// Function for working out the opponent's reach at every node (from its current strategy), and the prefix sums of that
+// reach at every end of the betting, ahead of updating the given player's hands
+void RiverSolver::prepareUpdate(int player) {
+    int q = 1 - player;
+    int nq = numHands[q];
+    for (int h = 0; h < nq; h++) {
+        opponentReach[h] = initialReach[q][h];
+    }
+    for (size_t n = 0; n < nodes.size(); n++) {
+        const RiverNode& node = nodes[n];
+        if (node.player != q) { // only the opponent's own decisions change its reach
+            continue;
+        }
+        const float* reach = &opponentReach[(size_t)node.reachSlot[q] * nq];
+        // regret matching: each action is played in proportion to its positive regret (evenly if none has any)
+        const float* nodeRegrets = &regrets[q][(size_t)node.slot * 4 * nq];
+        for (int h = 0; h < nq; h++) {
+            float total = 0.0;
+            for (int a = 0; a < node.numActions; a++) {
+                total += nodeRegrets[a * nq + h];
+            }
+            for (int a = 0; a < node.numActions; a++) {
+                float probability = (total > 0) ? (nodeRegrets[a * nq + h] / total) : (1.0f / node.numActions);
+                opponentReach[(size_t)nodes[node.children[a]].reachSlot[q] * nq + h] = reach[h] * probability;
+            }
+        }
+    }
+    // prefix sums over the opponent's hands weakest first, and then over each card's list of them
+    for (size_t slot = 0; slot < tableOffsets[q].size(); slot++) {
+        if (tableOffsets[q][slot] == -1) {
+            continue;
+        }
+        const float* reach = &opponentReach[slot * nq];
+        double* table = &tables[q][tableOffsets[q][slot]];
+        table[0] = 0.0;
+        for (int i = 0; i < nq; i++) {
+            table[i + 1] = table[i] + reach[sortedHands[q][i]];
+        }
+        double* cardTable = table + nq + 1;
+        for (int c = 0; c < 52; c++) {
+            double* cardSums = cardTable + cardListStart[q][c] + c;
+            cardSums[0] = 0.0;
+            int length = cardListStart[q][c + 1] - cardListStart[q][c];
+            for (int i = 0; i < length; i++) {
+                cardSums[i + 1] = cardSums[i] + reach[cardLists[q][cardListStart[q][c] + i]];
+            }
+        }
+    }
+}
+
+
+// Function for adding up the opponent's reach (in the given reach slot) against one of the player's hands, from the prefix
+// sums made by prepareUpdate: total is set to the reach over the hands that don't share a card with it, and share to how
+// much of that it beats at a showdown (ties counting half)
+void RiverSolver::opponentSums(int player, int slot, int hand, double* total, double* share) {
+    int q = 1 - player;
+    int nq = numHands[q];
+    const double* table = &tables[q][tableOffsets[q][slot]];
+    const double* cardTable = table + nq + 1;
+    double sameReach = (sameHand[player][hand] >= 0) ? opponentReach[(size_t)slot * nq + sameHand[player][hand]] : 0.0;
+    // the opponent's reach over every hand that doesn't share a card with this one (the hand with both of its cards
+    // is in both cards' lists, so it's taken out twice and added back once)
+    double compatible = table[nq] + sameReach;
+    double win = table[below[player][hand]];
+    double tie = table[atOrBelow[player][hand]] - table[below[player][hand]] + sameReach;
+    for (int k = 0; k < 2; k++) {
+        int card = comboTable.cards[combos[player][hand]][k];
+        const double* cardSums = cardTable + cardListStart[q][card] + card;
+        int length = cardListStart[q][card + 1] - cardListStart[q][card];
+        compatible -= cardSums[length];
+        win -= cardSums[cardBelow[player][hand][k]];
+        tie -= cardSums[cardAtOrBelow[player][hand][k]] - cardSums[cardBelow[player][hand][k]];
+    }
+    *total = compatible;
+    *share = win + 0.5 * tie;
+}
+
+
+// Function for one CFR+ update of the player's hands first to last (the rest are left to the other workers)
+// Works down the tree working out the hands' reach and current strategies, and then back up it working out their
+// values (at the ends of the betting, from the opponent's reach added up once per reach slot), adding to their regrets
+// (floored at 0), and adding the current strategies into the average strategies (weighted by the iteration and the
+// hands' reach)
+void RiverSolver::updateHands(int player, int iteration, int first, int last) {
+    int np = numHands[player];
+    int q = 1 - player;
+    for (size_t slot = 0; slot < tableOffsets[q].size(); slot++) {
+        if (tableOffsets[q][slot] != -1) {
+            for (int h = first; h < last; h++) {
+                opponentSums(player, (int)slot, h, &opponentTotals[slot * np + h], &showdownShares[slot * np + h]);
+            }
+        }
+    }
+    for (int h = first; h < last; h++) {
+        ownReach[h] = initialReach[player][h];
+    }
+    for (size_t n = 0; n < nodes.size(); n++) {
+        const RiverNode& node = nodes[n];
+        if (node.player != player) { // only the player's own decisions change its reach
+            continue;
+        }
+        const float* reach = &ownReach[(size_t)node.reachSlot[player] * np];
+        const float* nodeRegrets = &regrets[player][(size_t)node.slot * 4 * np];
+        float* nodeStrategy = &strategies[player][(size_t)node.slot * 4 * np];
+        for (int h = first; h < last; h++) {
+            float total = 0.0;
+            for (int a = 0; a < node.numActions; a++) {
+                total += nodeRegrets[a * np + h];
+            }
+            for (int a = 0; a < node.numActions; a++) {
+                float probability = (total > 0) ? (nodeRegrets[a * np + h] / total) : (1.0f / node.numActions);
+                nodeStrategy[a * np + h] = probability;
+                ownReach[(size_t)nodes[node.children[a]].reachSlot[player] * np + h] = reach[h] * probability;
+            }
+        }
+    }
+    for (int n = (int)nodes.size() - 1; n >= 0; n--) {
+        const RiverNode& node = nodes[n];
+        float* nodeValues = &values[(size_t)n * np];
+        if (node.player == -1) {
+            const double* totals = &opponentTotals[(size_t)node.reachSlot[q] * np];
+            const double* shares = &showdownShares[(size_t)node.reachSlot[q] * np];
+            int putIn = (player == 0) ? node.AIIn : node.userIn;
+            int finalPot = pot + node.AIIn + node.userIn;
+            for (int h = first; h < last; h++) {
+                if (node.folder == player) {
+                    nodeValues[h] = (float)(-putIn * totals[h]);
+                } else if (node.folder == q) {
+                    nodeValues[h] = (float)((finalPot - putIn) * totals[h]);
+                } else {
+                    nodeValues[h] = (float)(finalPot * shares[h] - putIn * totals[h]);
+                }
+            }
+            continue;
+        }
+        if (node.player != player) {
+            for (int h = first; h < last; h++) {
+                float total = 0.0;
+                for (int a = 0; a < node.numActions; a++) {
+                    total += values[(size_t)node.children[a] * np + h];
+                }
+                nodeValues[h] = total;
+            }
+            continue;
+        }
+        float* nodeRegrets = &regrets[player][(size_t)node.slot * 4 * np];
+        const float* nodeStrategy = &strategies[player][(size_t)node.slot * 4 * np];
+        float* nodeAverage = &averageStrategies[player][(size_t)node.slot * 4 * np];
+        const float* reach = &ownReach[(size_t)node.reachSlot[player] * np];
+        for (int h = first; h < last; h++) {
+            float value = 0.0;
+            for (int a = 0; a < node.numActions; a++) {
+                value += nodeStrategy[a * np + h] * values[(size_t)node.children[a] * np + h];
+            }
+            nodeValues[h] = value;
+            for (int a = 0; a < node.numActions; a++) {
+                float regret = nodeRegrets[a * np + h] + values[(size_t)node.children[a] * np + h] - value;
+                nodeRegrets[a * np + h] = (regret > 0) ? regret : 0.0f;
+                nodeAverage[a * np + h] += iteration * reach[h] * nodeStrategy[a * np + h];
+            }
+        }
+    }
+}
+
+
+// Function for reading the AI's average strategy at the decision being solved, for the hand with the given ComboTable
+// index: fills probabilities with how often to take each of node 0's actions (evenly if the hand has no strategy)
+void RiverSolver::rootStrategy(int combo, float* probabilities) {
+    const RiverNode& root = nodes[0];
+    int h = handOf[0][combo];
+    float total = 0.0;
+    for (int a = 0; a < root.numActions; a++) {
+        probabilities[a] = (h >= 0) ? averageStrategies[0][(size_t)a * numHands[0] + h] : 0.0f;
+        total += probabilities[a];
+    }
+    for (int a = 0; a < root.numActions; a++) {
+        probabilities[a] = (total > 0) ? (probabilities[a] / total) : (1.0f / root.numActions);
+    }
+}
@@ -0,0 +1,113 @@
+//
+//  Rng.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+#include <stdint.h>
+
+
+// Rng class (pseudo random number generator)
+// A small, fast xoshiro256** generator.  Every GameManager and AI owns its own Rng instead of sharing the global
+// rand(), so a game can be replayed exactly from its seed and separate games never touch each other's state.
+// Independent streams are made with forkStream, which hands out non-overlapping 2^128 long stretches of the sequence.
+class Rng {
+public:
+    uint64_t state[4];
+    // Default constructor, uses a fixed seed
+    Rng() {
+        seed(0x853C49E6748FEA9BULL);
+    }
+    // Overload constructor, seeds the generator with the input
+    Rng(uint64_t s) {
+        seed(s);
+    }
+    void seed(uint64_t s);
+    uint64_t next();
+    int nextInt(int n);
+    float nextFloat();
+    void jump();
+    Rng forkStream();
+};
+
+
+// Seeds the generator
+// The 256 bits of state are filled from the 64 bit seed with splitmix64, so similar seeds still give unrelated streams
+void Rng::seed(uint64_t s) {
+    for (int i = 0; i < 4; i++) {
+        s += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = s;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        state[i] = z ^ (z >> 31);
+    }
+}
+
+
+// Returns the next 64 random bits
+uint64_t Rng::next() {
+    uint64_t result = state[1] * 5;
+    result = ((result << 7) | (result >> 57)) * 9;
+    uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = (state[3] << 45) | (state[3] >> 19);
+    return result;
+}
+
+
+// Returns a uniformly random int from 0 to n-1 (n must be positive)
+// Uses a multiply and shift instead of %, rejecting the few values that would make small results more likely
+int Rng::nextInt(int n) {
+    uint64_t product = (next() >> 32) * (uint64_t)n;
+    uint32_t low = (uint32_t)product;
+    if (low < (uint32_t)n) {
+        uint32_t threshold = (uint32_t)(-(uint32_t)n) % (uint32_t)n;
+        while (low < threshold) {
+            product = (next() >> 32) * (uint64_t)n;
+            low = (uint32_t)product;
+        }
+    }
+    return (int)(product >> 32);
+}
+
+
+// Returns a uniformly random float in [0, 1)
+float Rng::nextFloat() {
+    return (float)(next() >> 40) * (1.0f / 16777216.0f);
+}
+
+
+// Advances the generator by 2^128 steps
+void Rng::jump() {
+    const uint64_t jumpPolynomial[4] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+    uint64_t newState[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (jumpPolynomial[i] & ((uint64_t)1 << b)) {
+                for (int j = 0; j < 4; j++) {
+                    newState[j] ^= state[j];
+                }
+            }
+            next();
+        }
+    }
+    for (int j = 0; j < 4; j++) {
+        state[j] = newState[j];
+    }
+}
+
+
+// Splits off an independent stream
+// The returned generator continues from the current state, and this generator jumps ahead 2^128 steps,
+// so the two never produce overlapping numbers
+Rng Rng::forkStream() {
+    Rng stream = *this;
+    jump();
+    return stream;
+}
@@ -0,0 +1,119 @@
+//
+//  SuitIsomorphism.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+using namespace std;
+
+
+// ------  SUIT ISOMORPHISM ------
+
+// No suit is better than another, so relabelling the suits (e.g. swapping every heart with every spade) never changes
+// how strong a hand is.  Two flops that only differ by such a relabelling are "isomorphic", and anything computed for
+// one holds for the other (with the hands relabelled the same way).  There are 22100 flops but only 1755 up to
+// isomorphism, so per flop results (see FlopCache) are computed and stored once per canonical flop.
+//
+// A set of cards is fully described, up to isomorphism, by its four 13 bit suit masks in no particular order.  So the
+// canonical form sorts the suits by their masks, biggest first, and relabels them Hearts, Diamonds, Spades, Clubs in that
+// order.
+
+// Function for finding the relabelling of suits that puts a set of cards into canonical form
+// Fills perm, where perm[s] is the suit that suit s becomes
+void canonicalSuitPermutation(CardSet cards, int* perm) {
+    uint32_t keys[4];
+    int order[4] = {0, 1, 2, 3};
+    for (int s = 0; s < 4; s++) {
+        keys[s] = (uint32_t)cards.suitMask(s);
+    }
+    // insertion sort the four suits, biggest key first (equal keys keep their order)
+    for (int i = 1; i < 4; i++) {
+        int suit = order[i];
+        int j = i - 1;
+        while ((j >= 0) && (keys[order[j]] < keys[suit])) {
+            order[j + 1] = order[j];
+            j -= 1;
+        }
+        order[j + 1] = suit;
+    }
+    for (int i = 0; i < 4; i++) {
+        perm[order[i]] = i;
+    }
+}
+
+// Function for relabelling the suits of a set of cards (perm[s] is the suit that suit s becomes)
+CardSet permuteSuits(CardSet cards, const int* perm) {
+    CardSet result;
+    for (int s = 0; s < 4; s++) {
+        result.bits |= (uint64_t)cards.suitMask(s) << (13 * perm[s]);
+    }
+    return result;
+}
+
+// Function for relabelling the suit of a single card id
+int permuteCard(int id, const int* perm) {
+    return 13 * perm[id / 13] + (id % 13);
+}
+
+// Function for putting a board into canonical form
+CardSet canonicalBoard(CardSet board) {
+    int perm[4];
+    canonicalSuitPermutation(board, perm);
+    return permuteSuits(board, perm);
+}
+
+
+// SuitIsomorphism Class
+// Numbers the canonical flops 0 - 1754, so per flop results can be stored in flat arrays.
+// Every one of the 22100 flops is looked up by its colex rank (see flopRank), which is mapped straight to the index of
+// its canonical flop, so a lookup never needs to sort or search.
+class SuitIsomorphism {
+public:
+    int numCanonicalFlops; // always 1755
+    CardSet canonicalFlops[1755]; // every canonical flop, by index
+    short flopCanonicalIndex[22100]; // the index of the canonical form of each flop, by colex rank
+    // Default constructor, fills in the tables
+    SuitIsomorphism() {
+        for (int r = 0; r < 22100; r++) {
+            flopCanonicalIndex[r] = -1;
+        }
+        numCanonicalFlops = 0;
+        for (int c = 2; c < 52; c++) {
+            for (int b = 1; b < c; b++) {
+                for (int a = 0; a < b; a++) {
+                    CardSet flop(((uint64_t)1 << a) | ((uint64_t)1 << b) | ((uint64_t)1 << c));
+                    CardSet canonical = canonicalBoard(flop);
+                    int canonicalRank = flopRank(canonical);
+                    if (flopCanonicalIndex[canonicalRank] == -1) { // first time this canonical flop has come up
+                        flopCanonicalIndex[canonicalRank] = (short)numCanonicalFlops;
+                        canonicalFlops[numCanonicalFlops] = canonical;
+                        numCanonicalFlops += 1;
+                    }
+                    flopCanonicalIndex[flopRank(flop)] = flopCanonicalIndex[canonicalRank];
+                }
+            }
+        }
+    }
+    // Returns a flop's colex rank, 0 - 22099 (with the card ids a < b < c, it's a + b choose 2 + c choose 3)
+    static int flopRank(CardSet flop) {
+        uint64_t bits = flop.bits;
+        int a = __builtin_ctzll(bits);
+        bits &= bits - 1;
+        int b = __builtin_ctzll(bits);
+        bits &= bits - 1;
+        int c = __builtin_ctzll(bits);
+        return a + b * (b - 1) / 2 + c * (c - 1) * (c - 2) / 6;
+    }
+    // Returns the index (0 - 1754) of a flop's canonical form
+    int flopIndex(CardSet flop) {
+        return flopCanonicalIndex[flopRank(flop)];
+    }
+    // Returns the canonical flop with the given index
+    CardSet flopFromIndex(int index) {
+        return canonicalFlops[index];
+    }
+};
+
+SuitIsomorphism suitIsomorphism;
@@ -0,0 +1,192 @@
+//
+//  TableSimulator.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+#include <thread>
+#include <atomic>
+#include <vector>
+using namespace std;
+
+
+// TableSimulator Class
+// Runs thousands of independent heads up tables (headless, the AI against an AI or another opponent, see
+// newSimulationOpponent) across all cores.
+//
+// Scheduling: the tables are split evenly between the worker threads up front, and each worker keeps its share
+// as a range of table numbers packed into one 64 bit atomic (first table in the high 32 bits, one past the
+// last table in the low 32 bits).  A worker takes tables off the front of its own range, and once its range is empty
+// it steals the back half of another worker's range.  Both are a single compare-and-swap, so no locks are needed,
+// and workers that get fast tables simply end up doing more of them.
+//
+// Randomness: every table seeds its own GameManager from (seed + table number), so each table is an independent
+// stream and the totals don't depend on how many threads ran or which thread played which table.
+//
+// Results: each worker adds up its own tables' results, and only touches the shared atomic totals once per table.
+//
+// Threads: there's already one worker per core, so the AIs at each table are set to do all of their own work on the
+// worker's thread rather than starting threads of their own (which would make cores x cores threads).
+class TableSimulator {
+public:
+    long long numTables;
+    long long handsPerTable;
+    int startingStack;
+    uint64_t seed;
+    int numThreads;
+    const char* opponentName; // what sits in the user seat (see newSimulationOpponent)
+    vector<atomic<uint64_t>> workRanges; // one packed [first, end) range of tables per worker
+    atomic<long long> totalHands;
+    atomic<long long> totalUserWins;
+    atomic<long long> totalAIWins;
+    atomic<long long> totalTies;
+    atomic<long long> totalUserChips;
+    atomic<long long> totalUserChipsSquared;
+    // Overload constructor, a numThreads of 0 means one thread per core
+    TableSimulator(long long tables, long long hands, int stack, uint64_t s, int threads, const char* opponent) : workRanges(threads > 0 ? threads : defaultThreads()) {
+        opponentName = opponent;
+        numTables = tables;
+        handsPerTable = hands;
+        startingStack = stack;
+        seed = s;
+        numThreads = (int)workRanges.size();
+    }
+    static int defaultThreads() {
+        int cores = (int)thread::hardware_concurrency();
+        return (cores > 0) ? cores : 1;
+    }
+    SimulationResult run();
+    void work(int worker);
+    long long takeTable(int worker);
+    bool stealTables(int worker);
+    void playTable(GameManager& game, Player& opponent, long long table);
+};
+
+
+// Packs a [first, end) range of tables into one 64 bit value
+uint64_t packTableRange(uint64_t first, uint64_t end) {
+    return (first << 32) | end;
+}
+
+
+// Function for running all of the tables
+// Returns the totals over every hand played, from the user seat's point of view
+SimulationResult TableSimulator::run() {
+    totalHands = 0;
+    totalUserWins = 0;
+    totalAIWins = 0;
+    totalTies = 0;
+    totalUserChips = 0;
+    totalUserChipsSquared = 0;
+    // split the tables evenly between the workers to start
+    for (int w = 0; w < numThreads; w++) {
+        uint64_t first = (uint64_t)(numTables * w / numThreads);
+        uint64_t end = (uint64_t)(numTables * (w + 1) / numThreads);
+        workRanges[w] = packTableRange(first, end);
+    }
+    vector<thread> workers;
+    for (int w = 0; w < numThreads; w++) {
+        workers.push_back(thread(&TableSimulator::work, this, w));
+    }
+    for (int w = 0; w < numThreads; w++) {
+        workers[w].join();
+    }
+    SimulationResult result;
+    result.hands = totalHands;
+    result.userWins = totalUserWins;
+    result.AIWins = totalAIWins;
+    result.ties = totalTies;
+    result.userChips = totalUserChips;
+    result.userChipsSquared = totalUserChipsSquared;
+    return result;
+}
+
+
+// Function run by each worker thread: plays tables until there are none left to take or steal
+void TableSimulator::work(int worker) {
+    // every worker has its own table and opponent, reused from table to table
+    GameManager* game = new GameManager();
+    game->ai.decisionBudgetMs = 0; // so every table only depends on its seed (see GameManager::simulate)
+    Player* opponent = newSimulationOpponent(opponentName, true);
+    // the tables already keep every core busy, so each AI works out its equities and solves the river on the worker's
+    // own thread
+    game->ai.equityEngine.numThreads = 1;
+    game->ai.riverSolver.numThreads = 1;
+    while (true) {
+        long long table = takeTable(worker);
+        if (table >= 0) {
+            playTable(*game, *opponent, table);
+        } else if (!stealTables(worker)) {
+            break;
+        }
+    }
+    delete opponent;
+    delete game;
+}
+
+
+// Takes the next table off the front of a worker's own range
+// Returns the table number, or -1 if the range is empty
+long long TableSimulator::takeTable(int worker) {
+    uint64_t range = workRanges[worker].load();
+    while (true) {
+        uint64_t first = range >> 32;
+        uint64_t end = range & 0xFFFFFFFF;
+        if (first >= end) {
+            return -1;
+        }
+        if (workRanges[worker].compare_exchange_weak(range, packTableRange(first + 1, end))) {
+            return (long long)first;
+        }
+    }
+}
+
+
+// Steals the back half of the biggest range left among the other workers, and makes it this worker's range
+// Returns false if there was nothing left to steal (all tables have been taken)
+bool TableSimulator::stealTables(int worker) {
+    while (true) {
+        int victim = -1;
+        uint64_t victimRange = 0;
+        uint64_t mostLeft = 0;
+        for (int w = 0; w < numThreads; w++) {
+            uint64_t range = workRanges[w].load();
+            uint64_t left = ((range >> 32) < (range & 0xFFFFFFFF)) ? (range & 0xFFFFFFFF) - (range >> 32) : 0;
+            if ((w != worker) && (left > mostLeft)) {
+                victim = w;
+                victimRange = range;
+                mostLeft = left;
+            }
+        }
+        if (victim == -1) {
+            return false;
+        }
+        uint64_t first = victimRange >> 32;
+        uint64_t end = victimRange & 0xFFFFFFFF;
+        uint64_t middle = end - (mostLeft + 1) / 2; // if only one table is left, steal it
+        if (workRanges[victim].compare_exchange_strong(victimRange, packTableRange(first, middle))) {
+            // only this worker ever refills its own range, and it's empty, so a plain store is safe
+            workRanges[worker].store(packTableRange(middle, end));
+            return true;
+        }
+    }
+}
+
+
+// Plays one table: a fresh session of handsPerTable hands between two AIs
+void TableSimulator::playTable(GameManager& game, Player& opponent, long long table) {
+    game.seedRng(seed + (uint64_t)table);
+    opponent.seed(game.rng);
+    opponent.resetHand();
+    game.ai.resetHand();
+    game.userPlayer = &opponent;
+    SimulationResult result = game.simulate(handsPerTable, startingStack);
+    totalHands.fetch_add(result.hands, memory_order_relaxed);
+    totalUserWins.fetch_add(result.userWins, memory_order_relaxed);
+    totalAIWins.fetch_add(result.AIWins, memory_order_relaxed);
+    totalTies.fetch_add(result.ties, memory_order_relaxed);
+    totalUserChips.fetch_add(result.userChips, memory_order_relaxed);
+    totalUserChipsSquared.fetch_add(result.userChipsSquared, memory_order_relaxed);
+}
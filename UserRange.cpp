@@ -0,0 +1,292 @@
+//
+//  UserRange.cpp
+//  Texas Hold 'em
+//
+//  Created by Jonathan Redwine on 10/17/26.
+//  Copyright © 2019 JonathanRedwine. All rights reserved.
+//
+
+#include <algorithm>
+using namespace std;
+
+
+// UserRange Class
+// The hands the AI thinks the user could have, stored as a structure of arrays: one array per field, indexed like
+// ComboTable (hand x is comboTable.cards[x]).  Which hands are in the range is kept as a 1326 bit set (live), so
+// taking out every hand that holds a card is a few 64 bit AND-NOTs against that card's bit set in ComboTable, and
+// the size of the range is a popcount.
+//
+// The range is weighted: each hand's weight is how likely the AI thinks the user is to hold it, relative to the other
+// hands.  Every hand starts at 1, and the user's actions scale the weights by how likely the user would have been to
+// act that way with each hand (e.g. betting big with a weak hand is unlikely, but not impossible).  Hands out of the
+// range always have a weight of 0, and hands whose weight gets tiny are taken out so the range doesn't stay full size.
+//
+// The questions the AI asks on every decision (how much of the range's weight does the AI's hand beat, and which
+// strength cuts off the weakest part of the range) are answered from an index of the hands sorted by strength, with
+// the weights kept in a Fenwick tree (binary indexed tree) in that order, so any prefix of the sorted hands can be
+// added up in O(log n).  The index is sorted once whenever the strengths are scored (see markScored), and after
+// that every weight change just updates the tree.  Hands taken out of the range keep their place (and strength) in
+// the index with a weight of 0 until it's next sorted.  The index only holds positions: the weights and strengths
+// themselves are only ever stored in weights and strengths.
+class UserRange {
+public:
+    unsigned char firstCard[1326]; // the id of each hand's first card (in the original deck's order, see UserRange())
+    unsigned char secondCard[1326]; // the id of each hand's second card
+    uint64_t masks[1326]; // each hand's two cards as CardSet bits
+    uint64_t live[21]; // bit x is set while hand x is in the range
+    float weights[1326]; // how likely the user is to hold each hand (starts at 1, 0 once it's been removed)
+    float strengths[1326]; // each hand's latest strength (left as it was once it's been removed)
+    uint64_t scoredBoard; // the board cards the strengths were scored on
+    int scoredRound; // the betting round the strengths were scored on (-1 if they haven't been since the range was reset)
+    int numOrdered; // how many hands are in the strength index
+    short order[1326]; // the indexed hands, weakest first
+    short position[1326]; // where each hand is in order (-1 if it isn't indexed)
+    double weightTree[1327]; // Fenwick tree over the weights of the hands in order (1 based)
+    // Default constructor, starts with every hand in the range
+    // Each hand's two cards are listed in the order they came in the original deck (aces first, then twos, threes, etc.,
+    // with Hearts, Diamonds, Spades, Clubs within each value) rather than in id order, because the pre-flop straight
+    // heuristic depends on which card comes first (e.g. ace - two scores 0.5, but two - ace would score 1.0)
+    UserRange() {
+        for (int x = 0; x < 1326; x++) {
+            int first = comboTable.cards[x][0], second = comboTable.cards[x][1];
+            if (originalDeckPosition(second) < originalDeckPosition(first)) {
+                int temp = first;
+                first = second;
+                second = temp;
+            }
+            firstCard[x] = (unsigned char)first;
+            secondCard[x] = (unsigned char)second;
+            masks[x] = comboTable.masks[x];
+        }
+        reset();
+    }
+    // Returns where the card with the given id was in the original deck (0 - 51): the four aces, then the four twos, etc.
+    static int originalDeckPosition(int id) {
+        int value = (id % 13) + 2;
+        int suit = id / 13;
+        return ((value == 14) ? 0 : (value - 1) * 4) + suit;
+    }
+    // Puts every hand back in the range
+    void reset() {
+        for (int w = 0; w < 21; w++) {
+            live[w] = (w < 20) ? ~(uint64_t)0 : (((uint64_t)1 << (1326 - 1280)) - 1);
+        }
+        for (int x = 0; x < 1326; x++) {
+            weights[x] = 1.0;
+            strengths[x] = 0.0;
+        }
+        scoredRound = -1;
+        scoredBoard = 0;
+        sortByStrength();
+    }
+    // Returns whether the strengths were scored for the given board and betting round.  Hands only ever leave the range
+    // (until it's reset), so every hand still in it has an up to date strength.
+    bool scoredFor(CardSet board, int betRound) {
+        return (scoredRound == betRound) && (scoredBoard == board.bits);
+    }
+    // Records that the strengths have been scored for the given board and betting round, and re-sorts the index by them
+    void markScored(CardSet board, int betRound) {
+        scoredBoard = board.bits;
+        scoredRound = betRound;
+        sortByStrength();
+    }
+    // Returns whether hand x is still in the range
+    bool contains(int x) {
+        return (live[x / 64] >> (x % 64)) & 1;
+    }
+    // Takes hand x out of the range
+    void remove(int x) {
+        live[x / 64] &= ~((uint64_t)1 << (x % 64));
+        setWeight(x, 0.0);
+    }
+    // Returns how many hands are in the range
+    int size() {
+        int count = 0;
+        for (int w = 0; w < 21; w++) {
+            count += __builtin_popcountll(live[w]);
+        }
+        return count;
+    }
+    // Fills hands with the index of every hand in the range, lowest first
+    // Returns how many hands there are
+    int liveHands(int* hands) {
+        int count = 0;
+        for (int w = 0; w < 21; w++) {
+            uint64_t bits = live[w];
+            while (bits != 0) {
+                hands[count] = w * 64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                count += 1;
+            }
+        }
+        return count;
+    }
+    int removeCards(CardSet cards);
+    float weightedPercentile(double keptFraction);
+    float countAtOrBelow(float strength, float* totalWeight);
+    int scaleBelow(float threshold, float factor, float minWeight);
+    void sortByStrength();
+    void setWeight(int x, float weight);
+    double weightBefore(int count);
+    int countBelow(float strength, bool orEqual);
+};
+
+
+// Function for sorting the hands in the range by their current strengths and rebuilding the weight tree over them
+// (hands with the same strength are kept in index order, so the index only depends on the strengths)
+void UserRange::sortByStrength() {
+    int hands[1326];
+    numOrdered = liveHands(hands);
+    const float* handStrengths = strengths;
+    std::stable_sort(hands, hands + numOrdered, [handStrengths](int a, int b) { return handStrengths[a] < handStrengths[b]; });
+    for (int x = 0; x < 1326; x++) {
+        position[x] = -1;
+    }
+    for (int i = 0; i <= numOrdered; i++) {
+        weightTree[i] = 0.0;
+    }
+    for (int i = 0; i < numOrdered; i++) {
+        order[i] = hands[i];
+        position[hands[i]] = i;
+        // each node adds itself into its parent, which builds the whole tree in one pass
+        int node = i + 1;
+        weightTree[node] += weights[hands[i]];
+        int parent = node + (node & -node);
+        if (parent <= numOrdered) {
+            weightTree[parent] += weightTree[node];
+        }
+    }
+}
+
+
+// Function for changing the weight of hand x, keeping the weight tree up to date
+void UserRange::setWeight(int x, float weight) {
+    if (position[x] >= 0) {
+        double change = (double)weight - (double)weights[x];
+        for (int node = position[x] + 1; node <= numOrdered; node += node & -node) {
+            weightTree[node] += change;
+        }
+    }
+    weights[x] = weight;
+}
+
+
+// Function for counting the hands at the start of the index with a strength below (or, if orEqual, at or below) the
+// given strength, by binary search.  Strengths only change when they're re-scored, which re-sorts the index, so the
+// index is always in order of the current strengths.
+int UserRange::countBelow(float strength, bool orEqual) {
+    int low = 0, high = numOrdered;
+    while (low < high) {
+        int middle = (low + high) / 2;
+        float middleStrength = strengths[order[middle]];
+        if ((middleStrength < strength) || (orEqual && (middleStrength == strength))) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+
+// Function for adding up the weights of the first count hands in the index (the count weakest)
+double UserRange::weightBefore(int count) {
+    double total = 0.0;
+    for (int node = count; node > 0; node -= node & -node) {
+        total += weightTree[node];
+    }
+    return total;
+}
+
+
+// Function for taking every hand that holds one of the given cards out of the range
+// Returns how many hands were taken out
+int UserRange::removeCards(CardSet cards) {
+    int numRemoved = 0;
+    uint64_t cardBits = cards.bits;
+    while (cardBits != 0) {
+        int card = __builtin_ctzll(cardBits);
+        cardBits &= cardBits - 1;
+        for (int w = 0; w < 21; w++) {
+            uint64_t removed = live[w] & comboTable.cardCombos[card][w];
+            live[w] &= ~removed;
+            numRemoved += __builtin_popcountll(removed);
+            // the removed hands' weights are cleared too, so they stop counting towards the range's weight
+            while (removed != 0) {
+                int x = w * 64 + __builtin_ctzll(removed);
+                removed &= removed - 1;
+                setWeight(x, 0.0);
+            }
+        }
+    }
+    return numRemoved;
+}
+
+
+// Function for finding the strength where the strongest keptFraction of the range's weight ends, i.e. going through
+// the hands from strongest to weakest and adding up their weights, the strength of the hand that takes the total past
+// keptFraction of the range's weight
+// Works by walking down the weight tree to the first hand (weakest first) where the weight of the hands before it
+// reaches the weight that isn't kept, in O(log n)
+// Returns the strength (or the weakest hand's strength if keptFraction is the whole range, and 0 if the range is empty)
+float UserRange::weightedPercentile(double keptFraction) {
+    double totalWeight = weightBefore(numOrdered);
+    if ((numOrdered == 0) || (totalWeight <= 0)) {
+        return 0.0;
+    }
+    double weightLeft = totalWeight - keptFraction * totalWeight; // the weight of the weakest hands that aren't kept
+    int count = 0; // how many hands (weakest first) are known to weigh less than weightLeft in total
+    int step = 1;
+    while (step * 2 <= numOrdered) {
+        step *= 2;
+    }
+    for (; step > 0; step /= 2) {
+        if ((count + step <= numOrdered) && (weightTree[count + step] < weightLeft)) {
+            count += step;
+            weightLeft -= weightTree[count];
+        }
+    }
+    // rounding in the tree can leave a hand that's been taken out a tiny weight, so land on the nearest hand still in it
+    int i = min(count, numOrdered - 1);
+    while ((i < numOrdered - 1) && (weights[order[i]] <= 0)) {
+        i += 1;
+    }
+    while ((i > 0) && (weights[order[i]] <= 0)) {
+        i -= 1;
+    }
+    return strengths[order[i]];
+}
+
+
+// Function for adding up the weights of the hands in the range with a strength at or below the given strength
+// (i.e. how many of the user's hands the AI's hand beats or ties, when strength is the AI's)
+// The hands at or below strength are a prefix of the index, found by binary search, so this is O(log n)
+// Sets totalWeight to the weight of the whole range
+// Returns the weight of the hands at or below strength
+float UserRange::countAtOrBelow(float strength, float* totalWeight) {
+    int count = countBelow(strength, true);
+    *totalWeight = (float)weightBefore(numOrdered);
+    return (float)weightBefore(count);
+}
+
+
+// Function for scaling the weight of every hand in the range with a strength under the given threshold by factor
+// (a factor of 0 removes them).  Hands left with a weight under minWeight are taken out of the range.
+// Only the hands under the threshold are visited (they're a prefix of the index), and every hand in the range
+// already weighs at least minWeight, so no other hand can need taking out.
+// Returns how many hands were taken out
+int UserRange::scaleBelow(float threshold, float factor, float minWeight) {
+    int count = countBelow(threshold, false);
+    int numRemoved = 0;
+    for (int i = 0; i < count; i++) {
+        int x = order[i];
+        if (weights[x] > 0) {
+            setWeight(x, weights[x] * factor);
+            if (weights[x] < minWeight) {
+                remove(x);
+                numRemoved += 1;
+            }
+        }
+    }
+    return numRemoved;
+}
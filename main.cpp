@@ -7,14 +7,173 @@
 //
 
 #include <iostream>
+#include <cstring>
+#include <cmath>
 #include "GameManager.cpp"
+#include "TableSimulator.cpp"
+#include "BatchSimulator.cpp"
 using namespace std;
 
 
+// Function for reading cards from text like "AsKd" (two characters per card, see Card::fromText) into cards
+// At most maxCards are read, and every card has to be a real card that isn't already in used (it's added to used)
+// Returns the number of cards read, or -1 if the text isn't valid
+int parseCards(const char* text, Card* cards, int maxCards, CardSet& used) {
+    int length = (int)strlen(text);
+    if (((length % 2) != 0) || ((length / 2) > maxCards)) {
+        return -1;
+    }
+    for (int i = 0; i < length / 2; i++) {
+        cards[i] = Card::fromText(text + 2*i);
+        if ((cards[i].id() < 0) || used.contains(cards[i])) {
+            return -1;
+        }
+        used.add(cards[i]);
+    }
+    return length / 2;
+}
+
+
+// Function for taking an "--opponent <name>" option out of the arguments, wherever it is, so the rest can be read by
+// their positions
+// Returns the name given (NULL if the option has no name after it), or "ai" if there's no option
+const char* takeOpponentOption(int& argc, const char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--opponent") == 0) {
+            const char* name = (i + 1 < argc) ? argv[i + 1] : NULL;
+            int taken = (i + 1 < argc) ? 2 : 1;
+            for (int j = i; j + taken < argc; j++) {
+                argv[j] = argv[j + taken];
+            }
+            argc -= taken;
+            return name;
+        }
+    }
+    return "ai";
+}
+
+
 // Main function for the Texas Hold 'em app
 int main(int argc, const char * argv[]) {
-    srand((unsigned int)time(0)); // set seed for pseudo RNG, based on current time
     GameManager game;
+    game.seedRng((uint64_t)time(0)); // set seed for pseudo RNG, based on current time
+    // Table building mode: "./main --build-preflop-table <file> [samples per matchup] [seed] [threads]"
+    // samples every pre-flop matchup and saves the table (copy it to preflop_equity.bin to have the AI use it)
+    if ((argc >= 3) && (strcmp(argv[1], "--build-preflop-table") == 0)) {
+        int samples = (argc >= 4) ? atoi(argv[3]) : 20000;
+        if (samples <= 0) {
+            cout << "Usage: ./main --build-preflop-table <file> [samples per matchup] [seed] [threads]" << endl;
+            cout << "The number of samples per matchup has to be at least 1." << endl;
+            return 1;
+        }
+        uint64_t seed = (argc >= 5) ? strtoull(argv[4], NULL, 10) : (uint64_t)time(0);
+        int threads = (argc >= 6) ? atoi(argv[5]) : 0;
+        preflopTable.generate(samples, seed, threads);
+        if (!preflopTable.save(argv[2], samples)) {
+            cout << "Could not write " << argv[2] << endl;
+            return 1;
+        }
+        cout << "AA vs KK: " << preflopTable.lookup(preflopClass(12, 25), preflopClass(11, 24)) << endl;
+        cout << "AKs vs QQ: " << preflopTable.lookup(preflopClass(12, 11), preflopClass(10, 23)) << endl;
+        cout << "Saved " << argv[2] << endl;
+        return 0;
+    }
+    // Cache building mode: "./main --build-flop-cache <file>" scores every hand on every canonical flop and saves the
+    // scores (copy the file to flop_cache.bin to have the AI use it)
+    if ((argc >= 3) && (strcmp(argv[1], "--build-flop-cache") == 0)) {
+        if (!FlopCache::build(argv[2], scoreFlopForCache)) {
+            cout << "Could not write " << argv[2] << endl;
+            return 1;
+        }
+        cout << "Saved " << argv[2] << endl;
+        return 0;
+    }
+    // the pre-flop equity table is optional: without it, the AI estimates pre-flop equity by sampling
+    preflopTable.load("preflop_equity.bin");
+    // so is the flop cache: without it, the AI scores every hand on the flop itself
+    flopCache.open("flop_cache.bin");
+    // both headless modes take "--opponent ai|random|scripted" (anywhere after the mode) for the user seat, "ai" by default
+    const char* opponentName = "ai";
+    if ((argc >= 2) && ((strcmp(argv[1], "--simulate") == 0) || (strcmp(argv[1], "--simulate-tables") == 0))) {
+        opponentName = takeOpponentOption(argc, argv);
+        if ((opponentName == NULL) || !knownOpponent(opponentName)) {
+            cout << "Usage: ./main " << argv[1] << " ... [--opponent ai|random|scripted]" << endl;
+            return 1;
+        }
+    }
+    // Headless mode: "./main --simulate <hands> [seed]" plays the AI against an opponent as fast as possible and
+    // reports the results
+    if ((argc >= 3) && (strcmp(argv[1], "--simulate") == 0)) {
+        long long numHands = atoll(argv[2]);
+        if (argc >= 4) {
+            game.seedRng(strtoull(argv[3], NULL, 10));
+        }
+        // neither seat has a time budget per decision, so the results only depend on the seed
+        game.ai.decisionBudgetMs = 0;
+        Player* opponent = newSimulationOpponent(opponentName, false);
+        opponent->seed(game.rng);
+        game.userPlayer = opponent;
+        SimulationResult result = game.simulate(numHands, 200);
+        delete opponent;
+        cout << "Hands played: " << result.hands << endl;
+        cout << "Seat 1 (user seat) wins: " << result.userWins << endl;
+        cout << "Seat 2 (AI seat) wins: " << result.AIWins << endl;
+        cout << "Ties: " << result.ties << endl;
+        cout << "Seat 1 net chips: $" << result.userChips << endl;
+        return 0;
+    }
+    // All in equity mode: "./main --batch-equity <user cards> <AI cards> <deals> [board cards] [seed]", e.g.
+    // "./main --batch-equity AsKs QdQc 100000000" or "./main --batch-equity AsKs QdQc 1000000 2s7dQh"
+    if ((argc >= 5) && (strcmp(argv[1], "--batch-equity") == 0)) {
+        Card userCards[2];
+        Card AICards[2];
+        Card boardCards[5];
+        int numBoardCards = 0;
+        CardSet used;
+        bool valid = (parseCards(argv[2], userCards, 2, used) == 2) && (parseCards(argv[3], AICards, 2, used) == 2);
+        if (valid && (argc >= 6)) {
+            numBoardCards = parseCards(argv[5], boardCards, 5, used);
+            valid = (numBoardCards >= 0);
+        }
+        if (!valid) {
+            cout << "Usage: ./main --batch-equity <user cards> <AI cards> <deals> [board cards] [seed]" << endl;
+            cout << "Each player needs two cards and the board can have up to five, e.g. AsKs QdQc 1000000 2s7dQh," << endl;
+            cout << "and no card can be used twice." << endl;
+            return 1;
+        }
+        uint64_t seed = (argc >= 7) ? strtoull(argv[6], NULL, 10) : (uint64_t)time(0);
+        BatchSimulator simulator(4096, seed);
+        EquityResult result = simulator.runAllIn(userCards, AICards, boardCards, numBoardCards, atoll(argv[4]));
+        cout << "Deals: " << result.deals << endl;
+        cout << "User wins: " << result.userWins << ", AI wins: " << result.AIWins << ", ties: " << result.ties << endl;
+        cout << "User equity: " << result.userEquity << endl;
+        return 0;
+    }
+    // Parallel headless mode: "./main --simulate-tables <tables> <hands per table> [seed] [threads]"
+    // plays many independent tables (the AI against the opponent) across all cores (or the given number of threads)
+    if ((argc >= 4) && (strcmp(argv[1], "--simulate-tables") == 0)) {
+        long long numTables = atoll(argv[2]);
+        long long handsPerTable = atoll(argv[3]);
+        if ((numTables <= 0) || (handsPerTable <= 0)) {
+            cout << "Usage: ./main --simulate-tables <tables> <hands per table> [seed] [threads] [--opponent ai|random|scripted]" << endl;
+            cout << "The number of tables and the hands per table both have to be at least 1." << endl;
+            return 1;
+        }
+        uint64_t seed = (argc >= 5) ? strtoull(argv[4], NULL, 10) : (uint64_t)time(0);
+        int threads = (argc >= 6) ? atoi(argv[5]) : 0;
+        TableSimulator simulator(numTables, handsPerTable, 200, seed, threads, opponentName);
+        SimulationResult result = simulator.run();
+        double meanChips = (double)result.userChips / (double)result.hands;
+        double variance = (double)result.userChipsSquared / (double)result.hands - meanChips * meanChips;
+        cout << "Threads: " << simulator.numThreads << endl;
+        cout << "Hands played: " << result.hands << endl;
+        cout << "Seat 1 (user seat) wins: " << result.userWins << endl;
+        cout << "Seat 2 (AI seat) wins: " << result.AIWins << endl;
+        cout << "Ties: " << result.ties << endl;
+        cout << "Seat 1 net chips: $" << result.userChips << " ($" << meanChips << " +/- $"
+             << sqrt(variance / (double)result.hands) << " per hand)" << endl;
+        return 0;
+    }
     cout << "Welcome to Texas Hold 'em!" << endl;
     cout << "You will be playing against an AI named Daniel Negreanu." << endl;
     cout << "The game's small and big blinds are $1 and $2.  Both you and Daniel begin with $200." << endl;
@@ -39,7 +198,7 @@ int main(int argc, const char * argv[]) {
     userTestHand[6].value = 14;
     userTestHand[6].suit = 'S';
     cout << "USER TEST HAND: ";
-    int testUserStrength = game.findBestHand(userTestHand);
+    game.describeHand(analyzeHand(userTestHand, 7));
     
     Card* AITestHand = new Card[7];
     AITestHand[0].value = 13;
@@ -57,166 +216,14 @@ int main(int argc, const char * argv[]) {
     AITestHand[6].value = 14;
     AITestHand[6].suit = 'S';
     cout << "AI TEST HAND: ";
-    int testAIStrength = game.findBestHand(AITestHand);
-    game.resolveTie(testUserStrength, userTestHand, AITestHand);
+    game.describeHand(analyzeHand(AITestHand, 7));
+    game.describeShowdownWinner(findShowdownWinner(evaluateHand(userTestHand, 7), evaluateHand(AITestHand, 7)));
     */
     
     // Keep playing hands until the user decides they wish to quit (or an invalid input is entered)
     while (keepPlaying == 1) {
         hand += 1;
-        game.shuffleDeck();
-        if ((hand%2) == 1) { // if user is dealer
-            cout << "You are the dealer!" << endl;
-            game.AIHand[0] = game.drawCard();
-            game.userHand[0] = game.drawCard();
-            game.AIHand[1] = game.drawCard();
-            game.userHand[1] = game.drawCard();
-            game.potSize = 3;
-            game.userStack -= 2;
-            game.AIStack -= 1;
-        } else { // if AI is dealer
-            cout << "Daniel is the dealer!" << endl;
-            game.userHand[0] = game.drawCard();
-            game.AIHand[0] = game.drawCard();
-            game.userHand[1] = game.drawCard();
-            game.AIHand[1] = game.drawCard();
-            game.potSize = 3;
-            game.userStack -= 1;
-            game.AIStack -=2;
-        }
-        cout << "Dealing" << endl;
-        usleep(500000);
-        cout << "." << endl;
-        usleep(500000);
-        cout << "." << endl;
-        usleep(500000);
-        cout << "." << endl;
-        usleep(500000);
-        cout << endl << "---------------------------------------------" << endl;
-        game.displayTable();
-        // PRE-FLOP
-        int preFlopSuccess = 1;
-        // if neither player is already all in, have a betting round
-        if ((game.userStack > 0) && (game.AIStack > 0)) {
-            preFlopSuccess = game.bettingRound(hand%2, 0);
-        }
-        if (preFlopSuccess != -1) { // if no fold happened pre-flop, proceed
-            cout << "Dealing the flop" << endl;
-            usleep(500000);
-            cout << "." << endl;
-            usleep(500000);
-            cout << "." << endl;
-            usleep(500000);
-            cout << "." << endl;
-            usleep(500000);
-            game.drawCard();
-            game.drawCard();
-            game.drawCard();
-            cout << endl << "---------------------------------------------" << endl;
-            game.displayTable();
-            // FLOP
-            int flopSuccess = 1;
-            // if neither player is already all in, have a betting round
-            if ((game.userStack > 0) && (game.AIStack > 0)) {
-                flopSuccess = game.bettingRound(hand%2, 1);
-            }
-            if (flopSuccess != -1) { // if no fold happened at the flop, proceed
-                cout << "Dealing the turn" << endl;
-                usleep(500000);
-                cout << "." << endl;
-                usleep(500000);
-                cout << "." << endl;
-                usleep(500000);
-                cout << "." << endl;
-                usleep(500000);
-                game.drawCard();
-                cout << endl << "---------------------------------------------" << endl;
-                game.displayTable();
-                // TURN
-                int turnSuccess = 1;
-                // if neither player is already all in, have a betting round
-                if ((game.userStack > 0) && (game.AIStack > 0)) {
-                    turnSuccess = game.bettingRound(hand%2, 2);
-                }
-                if (turnSuccess != -1) { // if no fold happened at the turn, proceed
-                    cout << "Dealing the river" << endl;
-                    usleep(500000);
-                    cout << "." << endl;
-                    usleep(500000);
-                    cout << "." << endl;
-                    usleep(500000);
-                    cout << "." << endl;
-                    usleep(500000);
-                    game.drawCard();
-                    cout << endl << "---------------------------------------------" << endl;
-                    game.displayTable();
-                    // RIVER
-                    int riverSuccess = 1;
-                    // if neither player is already all in, have a betting round
-                    if ((game.userStack > 0) && (game.AIStack > 0)) {
-                        riverSuccess = game.bettingRound(hand%2, 3);
-                    }
-                    if (riverSuccess != -1) { // if no fold happened at the river, showdown
-                        cout << endl << "---------------------------------------------" << endl;
-                        cout << "Showdown!" << endl;
-                        usleep(500000);
-                        cout << "." << endl;
-                        usleep(500000);
-                        cout << "." << endl;
-                        usleep(500000);
-                        cout << "." << endl;
-                        usleep(500000);
-                        cout << endl << "Daniel's hand: ";
-                        for (int i = 0; i < 2; i++) {
-                            if (game.AIHand[i].value == 10) {
-                                cout << "T";
-                            } else if (game.AIHand[i].value == 11) {
-                                cout << "J";
-                            } else if (game.AIHand[i].value == 12) {
-                                cout << "Q";
-                            } else if (game.AIHand[i].value == 13) {
-                                cout << "K";
-                            } else if (game.AIHand[i].value == 14) {
-                                cout << "A";
-                            } else {
-                                cout << game.AIHand[i].value;
-                            }
-                            cout << game.AIHand[i].suit << " ";
-                        }
-                        cout << endl << "Daniel has: ";
-                        Card* AIPlayableCards = new Card[7];
-                        for (int i = 0; i < 5; i++) {
-                            AIPlayableCards[i] = game.drawnCards[i+4];
-                        }
-                        for(int i = 0; i < 2; i++) {
-                            AIPlayableCards[i+5] = game.AIHand[i];
-                        }
-                        int AIHandStrength = game.findBestHand(AIPlayableCards);
-                        cout << endl << "You have: ";
-                        Card* userPlayableCards = new Card[7];
-                        for (int i = 0; i < 5; i++) {
-                            userPlayableCards[i] = game.drawnCards[i+4];
-                        }
-                        for(int i = 0; i < 2; i++) {
-                            userPlayableCards[i+5] = game.userHand[i];
-                        }
-                        int userHandStrength = game.findBestHand(userPlayableCards);
-                        cout << endl;
-                        int handWinner = -1;
-                        if (userHandStrength > AIHandStrength) { // if user's hand is stronger
-                            cout << "You win!" << endl;
-                            handWinner = 1;
-                        } else if (userHandStrength < AIHandStrength) { // if AI's hand is stronger
-                            cout << "Daniel wins!" << endl;
-                            handWinner = 2;
-                        } else { // if they have the same strength hand, resolve tie
-                            handWinner = game.resolveTie(userHandStrength, userPlayableCards, AIPlayableCards);
-                        }
-                        game.finishHand(handWinner, hand%2);
-                    }
-                }
-            }
-        }
+        game.playHand(hand);
         // Ask if user wishes to play another hand
         if (game.userStack == 0) {
             cout << "You are out of money!  Game over." << endl;